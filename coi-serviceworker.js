@@ -0,0 +1,32 @@
+// Re-serves every same-origin response with the COOP/COEP headers that make the page
+// cross-origin isolated, so the threaded build gets SharedArrayBuffer on hosts (like
+// GitHub Pages) where response headers can't be configured.
+self.addEventListener("install", function () {
+  self.skipWaiting();
+});
+
+self.addEventListener("activate", function (event) {
+  event.waitUntil(self.clients.claim());
+});
+
+self.addEventListener("fetch", function (event) {
+  var request = event.request;
+  if (request.cache === "only-if-cached" && request.mode !== "same-origin") return;
+
+  event.respondWith(
+    fetch(request).then(function (response) {
+      if (response.status === 0) return response; // opaque, headers can't be changed
+
+      var headers = new Headers(response.headers);
+      headers.set("Cross-Origin-Opener-Policy", "same-origin");
+      headers.set("Cross-Origin-Embedder-Policy", "require-corp");
+      headers.set("Cross-Origin-Resource-Policy", "cross-origin");
+
+      return new Response(response.body, {
+        status: response.status,
+        statusText: response.statusText,
+        headers: headers,
+      });
+    })
+  );
+});
@@ -0,0 +1,255 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - learning environment
+*******************************************************************************************/
+
+#include "env.h"
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*******************************************************************************************
+*  FUNCTION DEFINITIONS
+*******************************************************************************************/
+
+GameInput EnvActionInput(uint32_t action)
+{
+    GameInput input = { 0 };
+    if (action >= ENV_ACTION_COUNT) return input;
+
+    if (action >= ENV_ACTION_WARP)
+    {
+        input.pressed |= INPUT_WARP;
+        action -= ENV_ACTION_WARP;
+    }
+
+    int move = action % ENV_MOVES;
+    int key  = (int)(action / ENV_MOVES) - 1;
+    input.up   = (move == ENV_MOVE_UP);
+    input.down = (move == ENV_MOVE_DOWN);
+    if (key >= 0) input.pressed |= 1ULL << key;
+    return input;
+}
+
+void EnvObserve(const GameState *gs, EnvObservation *observation)
+{
+    memset(observation, 0, sizeof(*observation));
+    memset(observation->cells, ENV_CELL_EMPTY, sizeof(observation->cells));
+
+    observation->playerY            = gs->playerPosition.y;
+    observation->wallSpeed          = gs->wallSpeed;
+    observation->keyCooldown        = gs->keyPressCooldown;
+    observation->bufferOverflow     = gs->bufferOverflow;
+    observation->invincibleTimeLeft = gs->playerInvincible ? gs->invincibleTimeLeft : 0.0f;
+    observation->blackHoleTimeLeft  = gs->blackHoleActive ? gs->blackHoleTimeLeft : 0.0f;
+    observation->invincibleCharges  = gs->invincibleCount;
+    observation->score              = gs->score;
+
+    // Walls the ship still has to pass, nearest first
+    const Wall *ahead[WALL_COUNT];
+    int         count = 0;
+    for (int i = 0; i < WALL_COUNT; i++)
+    {
+        const Wall *wall = &gs->walls[i];
+        if (!wall->active || wall->x + wall->thickness * BLOCK_SIZE < gs->playerPosition.x) continue;
+
+        int at = count++;
+        while (at > 0 && ahead[at - 1]->x > wall->x)
+        {
+            ahead[at] = ahead[at - 1];
+            at--;
+        }
+        ahead[at] = wall;
+    }
+
+    for (int w = 0; w < ENV_OBS_WALLS; w++)
+    {
+        if (w >= count)
+        {
+            observation->wallX[w] = ENV_NO_WALL;
+            continue;
+        }
+
+        const Wall *wall = ahead[w];
+        observation->wallX[w] = wall->x - gs->playerPosition.x;
+        for (int row = 0; row < WALL_ROWS; row++)
+        {
+            for (int col = 0; col < wall->thickness; col++)
+            {
+                const Block *block = &wall->blocks[row][col];
+                if (!block->active) continue;
+
+                uint64_t bit = InputKeyBit(block->letter);
+                int8_t   cell = ENV_CELL_BARRIER;
+                if (block->breakable && bit) cell = (int8_t)__builtin_ctzll(bit);
+                observation->cells[w][row][col] = cell;
+            }
+        }
+    }
+}
+
+void EnvInit(EnvInstance *env, const GameTuning *tuning, int frameSkip, float maxSeconds)
+{
+    memset(env, 0, sizeof(*env));
+    env->tuning     = *tuning;
+    env->frameSkip  = (frameSkip < 1) ? 1 : frameSkip;
+    env->maxSeconds = maxSeconds;
+
+    EnvResult unused;
+    EnvReset(env, 1, &unused);
+}
+
+void EnvReset(EnvInstance *env, uint32_t seed, EnvResult *result)
+{
+    GameResetTuned(&env->state, seed, ++env->runs, &env->tuning);
+    env->state.telemetryOff = true;
+    env->episodeSteps       = 0;
+
+    memset(result, 0, sizeof(*result));
+    EnvObserve(&env->state, &result->observation);
+}
+
+void EnvStep(EnvInstance *env, uint32_t action, EnvResult *result)
+{
+    GameState *gs        = &env->state;
+    GameInput  input     = EnvActionInput(action);
+    int        lastScore = gs->score;
+    bool       wasOver   = gs->gameOver;
+    uint32_t   events    = 0;
+
+    for (int tick = 0; tick < env->frameSkip && !gs->gameOver; tick++)
+    {
+        GameStep(gs, &input, SIM_DT);
+        events       |= gs->events;
+        input.pressed = 0;      // a press is an edge, not a hold
+    }
+    env->episodeSteps++;
+
+    EnvObserve(gs, &result->observation);
+    result->reward       = (float)(gs->score - lastScore) - ((gs->gameOver && !wasOver) ? 1.0f : 0.0f);
+    result->events       = events;
+    result->episodeSteps = env->episodeSteps;
+    result->done         = gs->gameOver;
+    result->truncated    = !gs->gameOver && env->maxSeconds > 0.0f && gs->playTime >= env->maxSeconds;
+}
+
+static size_t SharedSize(uint32_t instanceCount)
+{
+    return sizeof(EnvSharedHeader) + (size_t)instanceCount * sizeof(EnvChannel);
+}
+
+EnvSharedHeader *EnvSharedCreate(const char *name, uint32_t instanceCount, int frameSkip, float maxSeconds)
+{
+    shm_unlink(name);   // left behind by a server that didn't exit cleanly
+
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0) return NULL;
+
+    size_t size   = SharedSize(instanceCount);
+    void  *mapped = MAP_FAILED;
+    if (ftruncate(fd, size) == 0) mapped = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED)
+    {
+        shm_unlink(name);
+        return NULL;
+    }
+
+    // ftruncate zero-fills, so every ring starts out empty
+    EnvSharedHeader *header = mapped;
+    memcpy(header->magic, ENV_SHARED_MAGIC, 4);
+    header->version         = ENV_SHARED_VERSION;
+    header->ringSize        = ENV_RING_SIZE;
+    header->instanceCount   = instanceCount;
+    header->channelSize     = sizeof(EnvChannel);
+    header->observationSize = sizeof(EnvObservation);
+    header->resultSize      = sizeof(EnvResult);
+    header->frameSkip       = (frameSkip < 1) ? 1 : frameSkip;
+    header->maxSeconds      = maxSeconds;
+    atomic_store(&header->ready, 1);
+    return header;
+}
+
+EnvSharedHeader *EnvSharedAttach(const char *name)
+{
+    int fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0) return NULL;
+
+    struct stat info;
+    void *mapped = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && (size_t)info.st_size >= sizeof(EnvSharedHeader))
+    {
+        mapped = mmap(NULL, info.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (mapped == MAP_FAILED) return NULL;
+
+    EnvSharedHeader *header = mapped;
+    if (!atomic_load(&header->ready) || memcmp(header->magic, ENV_SHARED_MAGIC, 4) ||
+        header->version != ENV_SHARED_VERSION || header->ringSize != ENV_RING_SIZE ||
+        header->channelSize != sizeof(EnvChannel) || SharedSize(header->instanceCount) > (size_t)info.st_size)
+    {
+        munmap(mapped, info.st_size);
+        return NULL;
+    }
+    return header;
+}
+
+void EnvSharedClose(EnvSharedHeader *header, const char *unlinkName)
+{
+    if (header) munmap(header, SharedSize(header->instanceCount));
+    if (unlinkName) shm_unlink(unlinkName);
+}
+
+EnvChannel *EnvSharedChannel(EnvSharedHeader *header, uint32_t instance)
+{
+    if (instance >= header->instanceCount) return NULL;
+    return (EnvChannel *)((uint8_t *)header + sizeof(EnvSharedHeader) + (size_t)instance * sizeof(EnvChannel));
+}
+
+bool EnvPushRequest(EnvChannel *channel, uint32_t type, uint32_t value)
+{
+    unsigned int head = atomic_load_explicit(&channel->requestHead, memory_order_relaxed);
+    if (head - atomic_load_explicit(&channel->requestTail, memory_order_acquire) >= ENV_RING_SIZE) return false;
+
+    channel->requests[head % ENV_RING_SIZE] = (EnvRequest){ type, value };
+    atomic_store_explicit(&channel->requestHead, head + 1, memory_order_release);
+    return true;
+}
+
+const EnvResult *EnvPeekResult(EnvChannel *channel)
+{
+    unsigned int tail = atomic_load_explicit(&channel->resultTail, memory_order_relaxed);
+    if (tail == atomic_load_explicit(&channel->resultHead, memory_order_acquire)) return NULL;
+    return &channel->results[tail % ENV_RING_SIZE];
+}
+
+void EnvReleaseResult(EnvChannel *channel)
+{
+    unsigned int tail = atomic_load_explicit(&channel->resultTail, memory_order_relaxed);
+    atomic_store_explicit(&channel->resultTail, tail + 1, memory_order_release);
+}
+
+int EnvServeChannel(EnvChannel *channel, EnvInstance *env)
+{
+    unsigned int tail = atomic_load_explicit(&channel->requestTail, memory_order_relaxed);
+    unsigned int head = atomic_load_explicit(&channel->requestHead, memory_order_acquire);
+    unsigned int out  = atomic_load_explicit(&channel->resultHead, memory_order_relaxed);
+    int served = 0;
+
+    // Each request is answered straight into its result slot, then both rings move on
+    while (tail != head && out - atomic_load_explicit(&channel->resultTail, memory_order_acquire) < ENV_RING_SIZE)
+    {
+        EnvRequest request = channel->requests[tail % ENV_RING_SIZE];
+        EnvResult *result  = &channel->results[out % ENV_RING_SIZE];
+
+        if (request.type == ENV_REQUEST_RESET) EnvReset(env, request.value, result);
+        else                                   EnvStep(env, request.value, result);
+
+        atomic_store_explicit(&channel->resultHead, ++out, memory_order_release);
+        atomic_store_explicit(&channel->requestTail, ++tail, memory_order_release);
+        served++;
+    }
+    return served;
+}
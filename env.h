@@ -0,0 +1,147 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - learning environment
+ *
+ * A step/reset interface over GameStep for training and evaluating agents against the real
+ * game logic. An action is a movement (none, up, down), optionally a key (A-Z, 0-9) and
+ * optionally the warp; each step holds it for frameSkip ticks (the key is pressed on the
+ * first) and returns a compact observation, the reward and whether the run is over.
+ *
+ * tools/rlenv serves many instances to another process through a shared-memory segment:
+ * one pair of single-producer rings per instance, requests in and results out. The client
+ * writes requests and reads results in place, so nothing is copied or syscalled per step.
+ *
+ * Segment layout (native endianness, every ring index counts slots ever used):
+ *   EnvSharedHeader                      64 bytes
+ *   EnvChannel      channels[instanceCount]   channelSize bytes each, 64-byte aligned
+ * A channel is four 64-byte lines holding requestHead (client), requestTail (server),
+ * resultHead (server) and resultTail (client), then EnvRequest requests[ENV_RING_SIZE]
+ * and EnvResult results[ENV_RING_SIZE]. Slot i lives at index % ENV_RING_SIZE; a side
+ * publishes a slot by storing its head with release order after writing it. The client
+ * must keep at most ENV_RING_SIZE requests outstanding per instance.
+*******************************************************************************************/
+
+#ifndef ENV_H
+#define ENV_H
+
+#include "sim.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+// Actions: move + ENV_MOVES * (key + 1) + ENV_ACTION_WARP, key -1 for none
+#define ENV_MOVE_NONE       0
+#define ENV_MOVE_UP         1
+#define ENV_MOVE_DOWN       2
+#define ENV_MOVES           3
+#define ENV_ACTION_WARP     (ENV_MOVES * (INPUT_KEY_COUNT + 1))
+#define ENV_ACTION_COUNT    (2 * ENV_ACTION_WARP)
+#define ENV_ACTION(move, key)   ((move) + ENV_MOVES * ((key) + 1))
+
+// Observation cells: a key index (0-25 A-Z, 26-35 0-9, so 26 is a black hole) or these
+#define ENV_CELL_EMPTY      -1
+#define ENV_CELL_BARRIER    INPUT_KEY_COUNT
+#define ENV_OBS_WALLS       2           // nearest walls not yet passed, nearest first
+#define ENV_NO_WALL         (2.0f * SCREEN_WIDTH)
+
+#define ENV_SHARED_MAGIC    "DTRL"
+#define ENV_SHARED_VERSION  1
+#define ENV_RING_SIZE       64          // power of two
+
+#define ENV_REQUEST_STEP    0           // value: action
+#define ENV_REQUEST_RESET   1           // value: seed
+
+/*******************************************************************************************
+*  DATA STRUCTURES
+*******************************************************************************************/
+
+typedef struct {
+    float   playerY;                    // ship centre, pixels from the top
+    float   wallSpeed;                  // pixels per second
+    float   keyCooldown;                // seconds until a key can break a block
+    float   bufferOverflow;             // BUFFER OVERFLOW lockout left
+    float   invincibleTimeLeft;
+    float   blackHoleTimeLeft;
+    int32_t invincibleCharges;
+    int32_t score;
+    float   wallX[ENV_OBS_WALLS];       // left edge relative to the ship; ENV_NO_WALL if none
+    int8_t  cells[ENV_OBS_WALLS][WALL_ROWS][WALL_MAX_THICKNESS];   // row 0 at the top
+    uint8_t padding[2];
+} EnvObservation;
+
+typedef struct {
+    uint32_t type;                      // ENV_REQUEST_*
+    uint32_t value;
+} EnvRequest;
+
+typedef struct {
+    EnvObservation observation;
+    float          reward;              // points scored this step, -1 on death
+    uint32_t       events;              // SIM_EVENT_* raised during the step
+    uint32_t       episodeSteps;
+    uint8_t        done;                // the ship crashed
+    uint8_t        truncated;           // the episode hit the time limit alive
+    uint8_t        padding[2];
+} EnvResult;
+
+typedef struct {
+    _Alignas(64) atomic_uint requestHead;
+    _Alignas(64) atomic_uint requestTail;
+    _Alignas(64) atomic_uint resultHead;
+    _Alignas(64) atomic_uint resultTail;
+    _Alignas(64) EnvRequest requests[ENV_RING_SIZE];
+    EnvResult  results[ENV_RING_SIZE];
+} EnvChannel;
+
+typedef struct {
+    _Alignas(64) char magic[4];
+    uint16_t    version;
+    uint16_t    ringSize;               // ENV_RING_SIZE
+    uint32_t    instanceCount;
+    uint32_t    channelSize;            // sizeof(EnvChannel)
+    uint32_t    observationSize;        // sizeof(EnvObservation), for clients to check
+    uint32_t    resultSize;             // sizeof(EnvResult)
+    uint32_t    frameSkip;              // ticks per step
+    float       maxSeconds;             // episode time limit
+    atomic_uint shutdown;               // set by either side to stop the server
+    atomic_uint ready;                  // set last by the creator; attach fails until then
+} EnvSharedHeader;
+
+// One environment instance
+typedef struct {
+    GameState  state;
+    GameTuning tuning;
+    int        frameSkip;
+    float      maxSeconds;
+    uint32_t   episodeSteps;
+    uint32_t   runs;
+} EnvInstance;
+
+/*******************************************************************************************
+*  FUNCTION DECLARATIONS
+*******************************************************************************************/
+
+void       EnvInit(EnvInstance *env, const GameTuning *tuning, int frameSkip, float maxSeconds);
+void       EnvReset(EnvInstance *env, uint32_t seed, EnvResult *result);
+void       EnvStep(EnvInstance *env, uint32_t action, EnvResult *result);
+void       EnvObserve(const GameState *gs, EnvObservation *observation);
+GameInput  EnvActionInput(uint32_t action);    // what the action presses on its first tick
+
+// Shared-memory transport (POSIX shm_open name, e.g. "/deadtype-env")
+EnvSharedHeader *EnvSharedCreate(const char *name, uint32_t instanceCount, int frameSkip, float maxSeconds);
+EnvSharedHeader *EnvSharedAttach(const char *name);     // NULL if missing, not ready or incompatible
+void             EnvSharedClose(EnvSharedHeader *header, const char *unlinkName);   // the creator passes its name
+EnvChannel      *EnvSharedChannel(EnvSharedHeader *header, uint32_t instance);
+
+// Client side
+bool             EnvPushRequest(EnvChannel *channel, uint32_t type, uint32_t value);   // false when full
+const EnvResult *EnvPeekResult(EnvChannel *channel);   // oldest unread result in place, or NULL
+void             EnvReleaseResult(EnvChannel *channel);
+
+// Server side: answers the channel's queued requests, returns how many
+int              EnvServeChannel(EnvChannel *channel, EnvInstance *env);
+
+#endif // ENV_H
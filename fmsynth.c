@@ -0,0 +1,73 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - FM sound effects
+*******************************************************************************************/
+
+#include "fmsynth.h"
+#include <math.h>
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define FM_PI           3.14159265359f
+#define FM_TWO_PI       (2.0f * FM_PI)
+#define FM_HEADROOM     0.5f        // peak output, leaves room for effects that overlap
+
+/*******************************************************************************************
+*  FUNCTION DEFINITIONS
+*******************************************************************************************/
+
+// Linear attack, decay and release around a held sustain
+static float Envelope(const FmOperator *op, float length, float t)
+{
+    float level;
+    if (t < op->attack)                 level = t / op->attack;
+    else if (t < op->attack + op->decay) level = 1.0f - (1.0f - op->sustain) * (t - op->attack) / op->decay;
+    else                                level = op->sustain;
+
+    if (t < length) return level;
+    if (op->release <= 0.0f || t >= length + op->release) return 0.0f;
+
+    // Release from wherever the envelope was when the note ended
+    return Envelope(op, length + 1.0f, length) * (1.0f - (t - length) / op->release);
+}
+
+int FmPatchFrames(const FmPatch *patch, int sampleRate)
+{
+    float release = fmaxf(patch->carrier.release, patch->modulator.release);
+    return (int)ceilf((patch->length + release) * sampleRate);
+}
+
+void FmRender(const FmPatch *patch, int sampleRate, int16_t *out, int frames)
+{
+    float carrierPhase = 0.0f, modulatorPhase = 0.0f;
+    float previous[2]  = { 0.0f, 0.0f };   // last two modulator outputs, averaged for feedback
+    float glideRatio   = (patch->glide > 0.0f) ? patch->glide / patch->frequency : 1.0f;
+
+    for (int i = 0; i < frames; i++)
+    {
+        float t    = (float)i / sampleRate;
+        float note = patch->frequency * powf(glideRatio, fminf(t / patch->length, 1.0f));
+
+        if (patch->arpeggioSteps > 0)
+        {
+            int step = (int)(t / patch->arpeggioRate) % patch->arpeggioSteps;
+            note *= exp2f(patch->arpeggio[step] / 12.0f);
+        }
+
+        float feedback  = patch->feedback * FM_PI * 0.5f * (previous[0] + previous[1]);
+        float modulator = sinf(FM_TWO_PI * modulatorPhase + feedback);
+        previous[1] = previous[0];
+        previous[0] = modulator;
+
+        float index  = patch->modulator.level * Envelope(&patch->modulator, patch->length, t);
+        float sample = sinf(FM_TWO_PI * carrierPhase + index * modulator) * patch->carrier.level * Envelope(&patch->carrier, patch->length, t);
+        out[i] = (int16_t)lrintf(fmaxf(-1.0f, fminf(1.0f, sample * FM_HEADROOM)) * 32767.0f);
+
+        // Phases stay in [0, 1) so long sounds keep their precision
+        carrierPhase   += note * patch->carrier.ratio / sampleRate;
+        modulatorPhase += note * patch->modulator.ratio / sampleRate;
+        carrierPhase   -= floorf(carrierPhase);
+        modulatorPhase -= floorf(modulatorPhase);
+    }
+}
@@ -0,0 +1,56 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - FM sound effects
+ *
+ * A two-operator FM voice (a modulator with self-feedback driving a sine carrier, each
+ * with its own ADSR envelope), plus a pitch glide and an arpeggio, is enough for every
+ * effect in the game. Patches are a few dozen bytes and render to 16-bit mono PCM at
+ * startup, so no audio files ship at all. Strong feedback turns the modulator into noise,
+ * which is where the crash gets its grit.
+*******************************************************************************************/
+
+#ifndef FMSYNTH_H
+#define FMSYNTH_H
+
+#include <stdint.h>
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define FM_SAMPLE_RATE      44100
+#define FM_ARPEGGIO_STEPS   8
+
+/*******************************************************************************************
+*  DATA STRUCTURES
+*******************************************************************************************/
+
+typedef struct {
+    float ratio;            // frequency multiple of the note
+    float level;            // carrier: output gain 0-1; modulator: index in radians
+    float attack;           // seconds to full level
+    float decay;            // seconds from full to the sustain level
+    float sustain;          // 0-1, held until the note ends
+    float release;          // seconds to silence after the note ends
+} FmOperator;
+
+typedef struct {
+    const char *name;
+    float       frequency;          // Hz when the note starts
+    float       glide;              // Hz reached at the end of the note (exponential), 0 to hold
+    float       length;             // seconds the note is held before the release
+    float       feedback;           // modulator self-feedback 0-1
+    int         arpeggioSteps;      // 0 for none
+    float       arpeggioRate;       // seconds per step
+    int8_t      arpeggio[FM_ARPEGGIO_STEPS];   // semitones above the note, cycled
+    FmOperator  carrier;
+    FmOperator  modulator;
+} FmPatch;
+
+/*******************************************************************************************
+*  FUNCTION DECLARATIONS
+*******************************************************************************************/
+
+int  FmPatchFrames(const FmPatch *patch, int sampleRate);     // note plus the longest release
+void FmRender(const FmPatch *patch, int sampleRate, int16_t *out, int frames);
+
+#endif // FMSYNTH_H
@@ -3,7 +3,20 @@
 *******************************************************************************************/
 
 #include "raylib.h"
+#include "rlgl.h"
+#include "save.h"
+#include "sim.h"
+#include "runner.h"
+#include "telemetry.h"
+#include "net.h"
+#include "memstats.h"
+#include "leaderboard.h"
+#include "glyphs.h"
+#include "patterns.h"
+#include "trace.h"
+#include "fmsynth.h"
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <stdio.h>
 #include <math.h>
@@ -12,62 +25,59 @@
     #include <emscripten/emscripten.h>
 #endif
 
+#if defined(__EMSCRIPTEN_PTHREADS__) || !defined(PLATFORM_WEB)
+    #include <pthread.h>
+    #include <stdatomic.h>
+#endif
+
 /*******************************************************************************************
 *  DEFINES & CONSTANTS
 *******************************************************************************************/
 
-#define SCREEN_WIDTH   800
-#define SCREEN_HEIGHT  600
-#define BLOCK_SIZE     40
-#define WALL_COUNT     3
-
-// Color Definitions
-#define BACKGROUND BLACK
-#define CYAN          (Color){0, 255, 255, 255}
-#define DARKGOLD      (Color){184, 134, 11, 255}
-#define DARKORANGE    (Color){255, 140, 0, 255}
-#define LIGHTGREEN    (Color){144, 238, 144, 255}
-#define DARKRED       (Color){139, 0, 0, 255}
-#define AQUA          (Color){0, 255, 255, 255}
-#define TAN           (Color){210, 180, 140, 255}
-#define PLUM          (Color){221, 160, 221, 255}
-#define TEAL          (Color){0, 128, 128, 255}
-#define SALMON        (Color){250, 128, 114, 255}
-
-// Particle/Afterimage Limits
-#define MAX_PARTICLES    300
-#define MAX_AFTERIMAGES  10
-
-// Anti-spam settings
-#define KEY_COOLDOWN_TIME   0.15f   // seconds between any block-breaking key presses
-#define WRONG_KEY_FLASH_DUR 0.4f    // red flash duration on wrong key
-#define WRONG_KEY_LOCKOUT   0.6f    // input lockout duration for wrong key press
+// Where a run's walls come from (otherwise a pattern level index)
+#define WALLS_RANDOM     -1
+#define WALLS_DAILY      -2      // one level and seed per UTC day, the same for everyone
+
+// Post-processing
+#define TRAIL_PERSIST    0.8f    // afterimage feedback while invincible (0 = no trails)
+
+// Power saving on idle screens
+#define IDLE_FPS         15      // menu/pause frame rate once nobody is touching anything
+#define IDLE_GRACE_TIME  2.0     // seconds at full rate after the last input
+
+// Rendering stress test (--stress)
+#define STRESS_MAX_WALLS        64
+#define STRESS_MAX_THICKNESS    32
+#define STRESS_MAX_PARTICLES    32768
+#define STRESS_WARMUP_TIME      0.5f    // seconds before measuring each step
+#define STRESS_MEASURE_FRAMES   240
+#define STRESS_BURST_INTERVAL   0.1f
+#define STRESS_OUTPUT_FILE      "stress.csv"
+
+// Threaded web build: sounds are rendered on this many pool workers (see PTHREAD_POOL_SIZE)
+#define DECODE_THREADS          4
+#define MAX_SOUNDS              16      // native background loader
 
 /*******************************************************************************************
 *  GLOBAL VARIABLES
 *******************************************************************************************/
 
-// Game states
-int    invincibleCount      = 2;
-bool   playerInvincible     = false;
-float  invisibilityEndTime = 0.0f;
+// Front-end states (gameplay state lives in GameState, see sim.h)
 bool   soundEnabled        = true;
-bool   blackHoleActive     = false;
-float  blackHoleEndTime    = 0.0f;
-Vector2 blackHolePos       = { SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 };
-
-// Anti-spam state
-float  keyPressCooldown    = 0.0f;  // min time between block-breaking key presses
-float  wrongKeyFlash       = 0.0f;  // brief red overlay timer (every wrong press)
-float  bufferOverflow      = 0.0f;  // BUFFER OVERFLOW message + lockout timer
-int    wrongKeyStreak      = 0;     // consecutive wrong presses; resets on correct press
+bool   matchDisplayRate    = true;  // render at the monitor's refresh rate instead of 60 FPS
+bool   wordMode            = false; // rows carry whole words (applies from the next run)
+int    wallSource          = WALLS_RANDOM; // WALLS_RANDOM, WALLS_DAILY or a pattern level
 
 bool IsWindowFocused(void);
-bool   gameOver            = false;
 bool   paused              = false;
 bool   inMainMenu          = true;  // Start in the main menu
-int    score               = 0;
-float  wallSpeed           = 100;
+bool   showMemStats        = false; // F3 debug overlay
+int    pbScore             = 0;     // personal best, seeded from the save store
+uint32_t runId             = 0;     // run the front-end is currently showing
+
+// Session tracking (persisted to the save store when a run ends)
+int    sessionKeystrokes   = 0;
+bool   sessionRecorded     = false; // ensures each run is stored only once
 
 // Audio
 Sound crashSound;
@@ -80,121 +90,110 @@ Sound startSound;
 Sound comboSound;
 
 // Screen shake
-float  screenShake         = 0.0f; // Tracks screen shake intensity
-bool   gameOverTriggered   = false; // Ensures effect plays only once
-Vector2 playerCollisionPosition = { 0, 0 }; // Stores where the player collided
 Vector2 shakeOffset        = { 0, 0 }; // Store shake movement offsets
 
+// Framebuffer pixels per screen unit (> 1 on high-DPI displays)
+float  renderScale         = 1.0f;
+
+// State drawn this frame, blended between the last two simulation ticks
+GameState frameState;
+GameState rivalState;   // the opponent in versus mode
+
 /*******************************************************************************************
 *  DATA STRUCTURES
 *******************************************************************************************/
 
+// Score, PB and invincibility pips, baked into a texture and redrawn only when they change
 typedef struct {
-    Rectangle rect;
-    char letter;
-    bool active;
-    bool breakable;
-    float fadeAlpha;
-} Block;
+    RenderTexture2D target;   // premultiplied alpha, at render (high-DPI) resolution
+    int   score;
+    int   pbScore;
+    int   invincibleCount;
+} HudCache;
 
-typedef struct {
-    Block blocks[SCREEN_HEIGHT / BLOCK_SIZE][5];
-    float x;
-    int thickness;
-    bool active;
-    bool scored;
-} Wall;
+HudCache hud = { .score = -1, .pbScore = -1, .invincibleCount = -1 };
 
+// Gameplay is drawn offscreen, then shake, wrong-key flash, bloom and afterimage trails
+// are applied in a single shader pass
 typedef struct {
-    Vector2 position;
-    float alpha;
-} Afterimage;
-
-Afterimage afterimages[MAX_AFTERIMAGES];
-int        afterimageIndex = 0;
-
-// Particle system
+    RenderTexture2D scene;
+    RenderTexture2D history[2];   // previous composited frames, ping-ponged for trails
+    int             current;
+    Shader          shader;
+    int             historyLoc;
+    int             texelLoc;
+    int             shakeLoc;
+    int             flashLoc;
+    int             trailLoc;
+} PostFx;
+
+PostFx post;
+
+// Frame pacing chosen by UpdatePowerMode
+typedef enum {
+    POWER_FULL,     // playing, or input just arrived
+    POWER_IDLE,     // menu or pause with nobody touching anything
+    POWER_WAIT,     // unfocused idle screen: sleep until the OS delivers an event
+} PowerMode;
+
+PowerMode powerMode     = POWER_FULL;
+double    lastInputTime = 0.0;
+
+// One point on a stress curve: every knob the stress scene can turn
 typedef struct {
-    Vector2 position;
-    Vector2 velocity;
-    float   lifetime;
-    float   size;  // Random particle size
-    Color   color;
-} Particle;
+    int   wallCount;
+    int   thickness;
+    int   burstSize;            // particles per burst, one burst every STRESS_BURST_INTERVAL
+    float blackHoleFraction;    // share of the time a black hole is open
+    int   letterPercent;        // share of blocks that carry a letter
+} StressKnobs;
 
-Particle particles[MAX_PARTICLES];
-int      particleIndex = 0;
+bool stressMode = false;
 
 /*******************************************************************************************
 *  FUNCTION DECLARATIONS
 *******************************************************************************************/
 
-Color   GetBlockColor(char letter);
 void    DrawDistortedGrid(float speed, int cellSize, Color gridColor, Vector2 blackHoleCenter);
-void    ApplyScreenShake(float intensity);
-void    UpdateScreenShake(float deltaTime);
-Vector2 GetScreenShakeOffset();
+Vector2 GetScreenShakeOffset(float intensity);
 Vector2 RotatePoint(Vector2 point, Vector2 origin, float angle);
 
-void    SpawnParticles(Vector2 position, Color color);
-void    UpdateAndDrawParticles(float deltaTime);
+void    DrawParticleArray(const Particle *particles, int count);
+void    DrawParticles(const GameState *gs);
+void    DrawBlock(Font font, const Block *block);
+void    DrawWordLabels(const GameState *gs, const Wall *wall);
 
 void    DrawMovingGrid(float speed, int cellSize, Color gridColor);
 void    DrawRotatingBlock(Rectangle rect, Color color, float rotation, float scale);
-void    DrawRotatedTriangleWithGlow(Vector2 center, float size, float rotation, Color color);
-
-void    GenerateWall(Wall *wall, float x, int thickness, int score);
-void    ResetGameState(Wall walls[], Vector2 *playerPosition, int *score, float *wallSpeed, bool *gameOver, bool *gameOverTriggered, int *invincibleCount);
+void    DrawRotatedTriangle(Vector2 center, float size, float rotation, Color color);
+
+void    LoadPostFx(void);
+void    UnloadPostFx(void);
+void    BeginScene(void);
+void    EndScene(const GameState *gs);
+
+void    LoadHud(void);
+void    LoadSounds(const FmPatch *patches, Sound **sounds, int count);
+void    PumpSoundLoads(void);
+void    FinishSoundLoads(void);
+void    DrawHud(Font font, const GameState *gs);
+
+void    ApplyFrameRateMode(void);
+void    UpdatePowerMode(bool idleScreen);
+void    PlaySimEvents(uint32_t events, int score);
+void    TrackGameStates(const char *owner, size_t copies);
+uint64_t PollGameKeys(void);
+bool    RecordSession(const GameState *gs, DeathCause cause);
+void    ResetGameState(void);
+uint32_t PrepareNextRun(void);
+
+bool    StressKnobsForStep(int sweep, int step, StressKnobs *knobs, const char **name, float *value);
+void    RunStressTest(Font font);
 
 /*******************************************************************************************
 *  FUNCTION DEFINITIONS
 *******************************************************************************************/
 
-// Returns a color based on the letter of the block
-Color GetBlockColor(char letter)
-{
-    switch (letter)
-    {
-        case '0': return Fade(WHITE, 0.8f); // Special color for the Black Hole block
-        case 'A': return RED;
-        case 'B': return ORANGE;
-        case 'C': return GOLD;
-        case 'D': return GREEN;
-        case 'E': return SKYBLUE;
-        case 'F': return BLUE;
-        case 'G': return PURPLE;
-        case 'H': return PINK;
-        case 'I': return BEIGE;
-        case 'J': return MAROON;
-        case 'K': return DARKGREEN;
-        case 'L': return DARKBLUE;
-        case 'M': return DARKPURPLE;
-        case 'N': return DARKBROWN;
-        case 'O': return MAGENTA;
-        case 'P': return LIME;
-        case 'Q': return CYAN;
-        case 'R': return YELLOW;
-        case 'S': return GRAY;
-        case 'T': return DARKGRAY;
-        case 'U': return VIOLET;
-        case 'V': return DARKGOLD;
-        case 'W': return GRAY;
-        case 'X': return PURPLE;
-        case 'Y': return DARKORANGE;
-        case 'Z': return LIGHTGREEN;
-        case '1': return WHITE;
-        case '2': return GOLD;
-        case '3': return ORANGE;
-        case '4': return DARKRED;
-        case '5': return AQUA;
-        case '6': return TAN;
-        case '7': return PLUM;
-        case '8': return TEAL;
-        case '9': return SALMON;
-        default:  return BLACK;
-    }
-}
-
 // Function to draw nonbreakable blocks with a pattern overlay
 void DrawPatternedBlock(Rectangle rect, Color color)
 {
@@ -233,27 +232,11 @@ void DrawDistortedGrid(float speed, int cellSize, Color gridColor, Vector2 black
     }
 }
 
-// Applies a screen shake by setting an intensity
-void ApplyScreenShake(float intensity)
-{
-    screenShake = intensity;
-}
-
-// Updates the screen shake effect over time
-void UpdateScreenShake(float deltaTime)
-{
-    if (screenShake > 0)
-    {
-        screenShake -= deltaTime * 2.0f; // Reduce shake over time
-        if (screenShake < 0) screenShake = 0;
-    }
-}
-
 // Returns a vector offset for applying screen shake
-Vector2 GetScreenShakeOffset()
+Vector2 GetScreenShakeOffset(float intensity)
 {
-    return (screenShake > 0)
-        ? (Vector2){ GetRandomValue(-2, 2) * screenShake, GetRandomValue(-2, 2) * screenShake }
+    return (intensity > 0)
+        ? (Vector2){ GetRandomValue(-2, 2) * intensity, GetRandomValue(-2, 2) * intensity }
         : (Vector2){ 0, 0 };
 }
 
@@ -266,49 +249,87 @@ Vector2 RotatePoint(Vector2 point, Vector2 origin, float angle)
     };
 }
 
-// Spawns new particles at a given position with a given color
-void SpawnParticles(Vector2 position, Color color)
+// Draws live particles
+void DrawParticleArray(const Particle *particles, int count)
 {
-    int numParticles = (gameOverTriggered) ? 30 : 10; // More particles on Game Over
-
-    for (int i = 0; i < numParticles; i++)
+    for (int i = 0; i < count; i++)
     {
-        int index = particleIndex % MAX_PARTICLES; // Circular buffer
-
-        particles[index].position = position;
-
-        // More dramatic explosion on Game Over
-        float speed = GetRandomValue(30, (gameOverTriggered) ? 100 : 60) / 10.0f;
-        float angle = GetRandomValue(0, 360) * DEG2RAD;
-        particles[index].velocity = (Vector2){ cos(angle) * speed, sin(angle) * speed };
+        const Particle *particle = &particles[i];
+        if (particle->lifetime > 0)
+        {
+            // Render with size variation
+            DrawCircleV(particle->position, particle->size, Fade(particle->color, particle->lifetime));
+        }
+    }
+}
 
-        particles[index].lifetime = (gameOverTriggered) ? 1.5f : 0.8f; // Longer duration on death
-        particles[index].size     = GetRandomValue(3, (gameOverTriggered) ? 7 : 5);
-        particles[index].color    = color;
+void DrawParticles(const GameState *gs)
+{
+    TRACE_ZONE("DrawParticles");
+    DrawParticleArray(gs->particles, MAX_PARTICLES);
+}
 
-        particleIndex++;
+// Draws a live block: black hole, letter or unbreakable
+void DrawBlock(Font font, const Block *block)
+{
+    if (block->letter == '0')
+    {
+        // Black hole block: rainbow color with letter
+        float hue = fmod(GetTime() * 400, 360);
+        Color rainbowColor = ColorFromHSV(hue, 0.9f, 0.9f);
+        DrawRectangleRec(block->rect, rainbowColor);
+        char letter[2] = { '0', '\0' };
+        Vector2 textSize = MeasureTextEx(font, letter, 20, 1);
+        float textX = block->rect.x + (block->rect.width  - textSize.x) / 2;
+        float textY = block->rect.y + (block->rect.height - textSize.y) / 2;
+        DrawTextEx(font, letter, (Vector2){ textX + 1, textY + 1 }, 22, 1, Fade(BLACK, 0.5f));
+        DrawTextEx(font, letter, (Vector2){ textX, textY }, 22, 1, BLACK);
+    }
+    else if (block->breakable)
+    {
+        // Breakable block: draw with letter
+        Color blockColor = GetBlockColor(block->letter);
+        DrawRectangleRec(block->rect, blockColor);
+        char letter[2] = { block->letter, '\0' };
+        Vector2 textSize = MeasureTextEx(font, letter, 20, 1);
+        float textX = block->rect.x + (block->rect.width  - textSize.x) / 2;
+        float textY = block->rect.y + (block->rect.height - textSize.y) / 2;
+        Color textColor = ((blockColor.r + blockColor.g + blockColor.b) > 400) ? BLACK : WHITE;
+        DrawTextEx(font, letter, (Vector2){ textX + 1, textY + 1 }, 22, 1, Fade(BLACK, 0.5f));
+        DrawTextEx(font, letter, (Vector2){ textX, textY }, 22, 1, textColor);
+    }
+    else
+    {
+        DrawPatternedBlock(block->rect, BLACK);
+        DrawRectangleLinesEx(block->rect, 0.5f, GREEN);
     }
 }
 
-// Updates particles' positions and draws them
-void UpdateAndDrawParticles(float deltaTime)
+// Word mode: each live row's word left of its wall, with the part already typed lit up.
+// Labels draw through the glyph cache, so a later non-Latin word list needs no font change.
+void DrawWordLabels(const GameState *gs, const Wall *wall)
 {
-    for (int i = 0; i < MAX_PARTICLES; i++)
+    for (int row = 0; row < WALL_ROWS; row++)
     {
-        if (particles[i].lifetime > 0)
-        {
-            // Apply velocity
-            particles[i].position.x += particles[i].velocity.x * deltaTime * 60;
-            particles[i].position.y += particles[i].velocity.y * deltaTime * 60;
+        if (!(wall->wordLive & (1u << row))) continue;
 
-            // Apply slight gravity (frame-rate independent)
-            particles[i].velocity.y += 3.0f * deltaTime;
+        // Shown as 0x1F2E like the title; the sim matches the typed X
+        char label[WORD_MAX_LENGTH + 1];
+        strcpy(label, wall->words[row]);
+        if (label[0] == '0' && label[1] == 'X') label[1] = 'x';
 
-            // Reduce lifetime
-            particles[i].lifetime -= deltaTime;
+        int     typed     = WordMatcherProgress(&gs->matcher, wall->words[row]);
+        Vector2 labelSize = GlyphCacheMeasureText(label, 18, 1);
+        Vector2 position  = { wall->x - labelSize.x - 6, row * BLOCK_SIZE + (BLOCK_SIZE - labelSize.y) / 2 };
 
-            // Render with size variation
-            DrawCircleV(particles[i].position, particles[i].size, Fade(particles[i].color, particles[i].lifetime));
+        GlyphCacheDrawText(label, (Vector2){ position.x + 1, position.y + 1 }, 18, 1, Fade(BLACK, 0.6f));
+        GlyphCacheDrawText(label, position, 18, 1, LIGHTGRAY);
+        if (typed > 0)
+        {
+            char prefix[WORD_MAX_LENGTH + 1];
+            memcpy(prefix, label, typed);
+            prefix[typed] = '\0';
+            GlyphCacheDrawText(prefix, position, 18, 1, GREEN);
         }
     }
 }
@@ -350,8 +371,8 @@ void DrawRotatingBlock(Rectangle rect, Color color, float rotation, float scale)
     DrawRectanglePro(scaledRect, (Vector2){scaledRect.width / 2, scaledRect.height / 2}, rotation, color);
 }
 
-// Draws a triangle (player ship) with a glow effect and rotation
-void DrawRotatedTriangleWithGlow(Vector2 center, float size, float rotation, Color color)
+// Draws a triangle (player ship) with rotation; its glow comes from the bloom pass
+void DrawRotatedTriangle(Vector2 center, float size, float rotation, Color color)
 {
     float radians = rotation * DEG2RAD;
     float cosR    = cosf(radians);
@@ -369,174 +390,855 @@ void DrawRotatedTriangleWithGlow(Vector2 center, float size, float rotation, Col
     Vector2 rotLeft  = { ROT_X(lx, ly), ROT_Y(lx, ly) };
     Vector2 rotRight = { ROT_X(rx, ry), ROT_Y(rx, ry) };
 
-    Color glowColor = Fade(color, 0.2f);
-    for (float g = 1.0f; g <= 3.0f; g += 1.0f)
-    {
-        DrawTriangleLines(
-            (Vector2){ ROT_X(tx + g, ty + g), ROT_Y(tx + g, ty + g) },
-            (Vector2){ ROT_X(lx - g, ly - g), ROT_Y(lx - g, ly - g) },
-            (Vector2){ ROT_X(rx - g, ry + g), ROT_Y(rx - g, ry + g) },
-            glowColor);
-    }
-
     DrawTriangleLines(rotTop, rotLeft, rotRight, color);
 
     #undef ROT_X
     #undef ROT_Y
 }
 
-// Generates a wall of blocks at a given x position with certain thickness
-void GenerateWall(Wall *wall, float x, int thickness, int score)
+// Post-processing fragment shader (default raylib vertex shader)
+#if defined(PLATFORM_WEB)
+    #define POSTFX_GLSL_HEADER \
+        "#version 100\n" \
+        "precision mediump float;\n" \
+        "varying vec2 fragTexCoord;\n" \
+        "varying vec4 fragColor;\n" \
+        "#define texture texture2D\n" \
+        "#define finalColor gl_FragColor\n"
+#else
+    #define POSTFX_GLSL_HEADER \
+        "#version 330\n" \
+        "in vec2 fragTexCoord;\n" \
+        "in vec4 fragColor;\n" \
+        "out vec4 finalColor;\n"
+#endif
+
+static const char *postFxShaderCode = POSTFX_GLSL_HEADER
+    "uniform sampler2D texture0;\n"     // scene
+    "uniform sampler2D history;\n"      // last composited frame
+    "uniform vec2  texel;\n"
+    "uniform vec2  shake;\n"            // in texels
+    "uniform float flash;\n"
+    "uniform float trail;\n"
+    "vec3 Bright(vec2 uv)\n"
+    "{\n"
+    "    vec3 c = texture(texture0, uv).rgb;\n"
+    "    return max(c - vec3(0.55), 0.0);\n"     // only bright pixels glow
+    "}\n"
+    "void main()\n"
+    "{\n"
+    "    vec2 uv    = fragTexCoord + shake * texel;\n"
+    "    vec3 color = texture(texture0, uv).rgb;\n"
+    "    vec3 bloom = vec3(0.0);\n"
+    "    for (int i = 0; i < 8; i++)\n"
+    "    {\n"
+    "        float a = float(i) * 0.785398;\n"
+    "        vec2  d = vec2(cos(a), sin(a)) * texel;\n"
+    "        bloom += Bright(uv + d * 2.0) * 0.09 + Bright(uv + d * 5.0) * 0.05;\n"
+    "    }\n"
+    "    color += bloom * 0.6;\n"
+    "    color  = max(color, texture(history, fragTexCoord).rgb * trail);\n"
+    "    color  = mix(color, vec3(0.9, 0.16, 0.22), flash);\n"
+    "    finalColor = vec4(color, 1.0);\n"
+    "}\n";
+
+// Creates the offscreen targets and the composite shader
+void LoadPostFx(void)
+{
+    int width  = SCREEN_WIDTH  * renderScale;
+    int height = SCREEN_HEIGHT * renderScale;
+
+    post.scene      = LoadRenderTexture(width, height);
+    post.history[0] = LoadRenderTexture(width, height);
+    post.history[1] = LoadRenderTexture(width, height);
+    post.current    = 0;
+    MemStatsTrackRenderTexture("post scene", post.scene);
+    MemStatsTrackRenderTexture("post history 0", post.history[0]);
+    MemStatsTrackRenderTexture("post history 1", post.history[1]);
+
+    post.shader     = LoadShaderFromMemory(NULL, postFxShaderCode);
+    post.historyLoc = GetShaderLocation(post.shader, "history");
+    post.texelLoc   = GetShaderLocation(post.shader, "texel");
+    post.shakeLoc   = GetShaderLocation(post.shader, "shake");
+    post.flashLoc   = GetShaderLocation(post.shader, "flash");
+    post.trailLoc   = GetShaderLocation(post.shader, "trail");
+
+    Vector2 texel = { 1.0f / width, 1.0f / height };
+    SetShaderValue(post.shader, post.texelLoc, &texel, SHADER_UNIFORM_VEC2);
+
+    // Clamp so shaken samples at the border repeat the edge instead of wrapping
+    SetTextureWrap(post.scene.texture, TEXTURE_WRAP_CLAMP);
+}
+
+void UnloadPostFx(void)
+{
+    UnloadShader(post.shader);
+    UnloadRenderTexture(post.scene);
+    UnloadRenderTexture(post.history[0]);
+    UnloadRenderTexture(post.history[1]);
+}
+
+// Starts drawing the gameplay scene offscreen (in screen units)
+void BeginScene(void)
+{
+    BeginTextureMode(post.scene);
+    ClearBackground(BACKGROUND);
+    BeginMode2D((Camera2D){ .zoom = renderScale });
+}
+
+// Composites the scene with all screen effects in one pass and puts it on screen
+void EndScene(const GameState *gs)
+{
+    EndMode2D();
+    EndTextureMode();
+
+    RenderTexture2D previous = post.history[post.current];
+    post.current = 1 - post.current;
+
+    Vector2 shake = { shakeOffset.x * renderScale, shakeOffset.y * renderScale };
+    float   flash = (gs->wrongKeyFlash > 0.0f) ? gs->wrongKeyFlash * 0.25f : 0.0f;
+    float   trail = gs->playerInvincible ? TRAIL_PERSIST : 0.0f;
+
+    // Render textures are stored upside down
+    Rectangle source = { 0, 0, post.scene.texture.width, -post.scene.texture.height };
+
+    BeginTextureMode(post.history[post.current]);
+    BeginShaderMode(post.shader);
+    SetShaderValue(post.shader, post.shakeLoc, &shake, SHADER_UNIFORM_VEC2);
+    SetShaderValue(post.shader, post.flashLoc, &flash, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(post.shader, post.trailLoc, &trail, SHADER_UNIFORM_FLOAT);
+    SetShaderValueTexture(post.shader, post.historyLoc, previous.texture);
+    DrawTextureRec(post.scene.texture, source, (Vector2){ 0, 0 }, WHITE);
+    EndShaderMode();
+    EndTextureMode();
+
+    DrawTexturePro(post.history[post.current].texture, source,
+            (Rectangle){ 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT }, (Vector2){ 0, 0 }, 0.0f, WHITE);
+}
+
+// Every effect is an FM patch (fmsynth.h), voiced to match the WAVs the game used to ship
+static const FmPatch soundPatches[] = {
+    { .name = "crash", .frequency = 185.0f, .glide = 30.0f, .length = 1.2f, .feedback = 0.9f,
+      .carrier   = { 1.0f, 0.7f, 0.002f, 0.8f, 0.5f, 1.4f },
+      .modulator = { 1.41f, 4.0f, 0.0f, 1.5f, 0.3f, 1.4f } },
+    { .name = "blackhole", .frequency = 520.0f, .glide = 172.0f, .length = 1.5f, .feedback = 0.2f,
+      .carrier   = { 1.0f, 0.6f, 0.01f, 0.2f, 0.8f, 0.4f },
+      .modulator = { 2.01f, 2.0f, 0.05f, 1.0f, 0.5f, 0.4f } },
+    { .name = "blockDestroy", .frequency = 185.0f, .glide = 135.0f, .length = 0.08f, .feedback = 0.5f,
+      .carrier   = { 1.0f, 0.6f, 0.001f, 0.1f, 0.3f, 0.12f },
+      .modulator = { 3.0f, 3.0f, 0.0f, 0.05f, 0.2f, 0.1f } },
+    { .name = "pause", .frequency = 527.0f, .glide = 720.0f, .length = 0.1f,
+      .carrier   = { 1.0f, 0.6f, 0.002f, 0.05f, 0.7f, 0.07f },
+      .modulator = { 1.0f, 1.0f, 0.0f, 0.1f, 0.5f, 0.07f } },
+    { .name = "warp", .frequency = 150.0f, .glide = 345.0f, .length = 0.25f, .feedback = 0.1f,
+      .carrier   = { 1.0f, 0.6f, 0.005f, 0.1f, 0.8f, 0.1f },
+      .modulator = { 2.0f, 3.0f, 0.0f, 0.25f, 0.4f, 0.1f } },
+    { .name = "scoreup", .frequency = 215.0f, .length = 0.08f,
+      .carrier   = { 1.0f, 0.6f, 0.002f, 0.06f, 0.5f, 0.06f },
+      .modulator = { 2.0f, 1.5f, 0.0f, 0.08f, 0.3f, 0.06f } },
+    { .name = "start", .frequency = 301.0f, .length = 0.6f,
+      .arpeggioSteps = 6, .arpeggioRate = 0.1f, .arpeggio = { 0, 2, 5, 9, 13, 17 },
+      .carrier   = { 1.0f, 0.6f, 0.005f, 0.1f, 0.7f, 0.12f },
+      .modulator = { 1.0f, 1.2f, 0.0f, 0.6f, 0.6f, 0.12f } },
+    { .name = "combo", .frequency = 690.0f, .length = 0.24f,
+      .arpeggioSteps = 3, .arpeggioRate = 0.1f, .arpeggio = { 0, 7, 14 },
+      .carrier   = { 1.0f, 0.6f, 0.002f, 0.05f, 0.7f, 0.08f },
+      .modulator = { 1.0f, 1.0f, 0.0f, 0.24f, 0.5f, 0.08f } },
+};
+
+// 16-bit mono, in memory raylib owns so UnloadWave can free it
+static Wave RenderPatchWave(const FmPatch *patch)
 {
-    wall->x         = x;
-    wall->thickness = thickness;
-    wall->active    = true;
-    wall->scored    = false;
+    TRACE_ZONE("FmRender");
+    int  frames = FmPatchFrames(patch, FM_SAMPLE_RATE);
+    Wave wave   = { .sampleRate = FM_SAMPLE_RATE, .sampleSize = 16, .channels = 1 };
 
-    for (int row = 0; row < SCREEN_HEIGHT / BLOCK_SIZE; row++)
+    wave.data = MemAlloc(frames * sizeof(int16_t));
+    if (wave.data)
     {
-        bool hasBreakableBlock = false;
+        FmRender(patch, FM_SAMPLE_RATE, wave.data, frames);
+        wave.frameCount = frames;
+    }
+    return wave;
+}
 
-        for (int col = 0; col < thickness; col++)
-        {
-            Block *block  = &wall->blocks[row][col];
-            block->rect   = (Rectangle){ x + col * BLOCK_SIZE, row * BLOCK_SIZE, BLOCK_SIZE, BLOCK_SIZE };
-            block->breakable = (GetRandomValue(1, 100) <= 80);
+#ifdef __EMSCRIPTEN_PTHREADS__
 
-            if (block->breakable)
-            {
-                if (GetRandomValue(1, 100) <= 5)
-                {
-                    block->letter = '0' + GetRandomValue(0, 9);
-                }
-                else if (GetRandomValue(1, 200) <= 1)
-                {
-                    block->letter = '0';
-                }
-                else
-                {
-                    // Avoid W or S if possible
-                    do {
-                        block->letter = 'A' + GetRandomValue(0, 25);
-                    } while (block->letter == 'W' || block->letter == 'S');
-                }
-                hasBreakableBlock = true;
-            }
-            else
-            {
-                block->letter = '\0';
-            }
+typedef struct {
+    const FmPatch *patch;
+    Wave           wave;
+} SoundDecode;
+
+static SoundDecode *decodeJobs;
+static int          decodeCount;
+static atomic_int   decodeNext;
+
+static void *DecodeWorker(void *arg)
+{
+    (void)arg;
+    for (int i; (i = atomic_fetch_add(&decodeNext, 1)) < decodeCount; )
+    {
+        decodeJobs[i].wave = RenderPatchWave(decodeJobs[i].patch);
+    }
+    return NULL;
+}
+
+#elif !defined(PLATFORM_WEB)
+
+// Native: one loader thread renders every patch while the menu is already running
+typedef struct {
+    const FmPatch *patch;
+    Sound         *sound;
+    Wave           wave;
+    atomic_bool    decoded;   // wave is ready for the main thread
+    bool           uploaded;
+} SoundLoad;
+
+static SoundLoad soundLoads[MAX_SOUNDS];
+static int       soundLoadCount    = 0;
+static int       soundLoadsPending = 0;     // not uploaded yet
+static pthread_t soundLoader;
+static bool      soundLoaderRunning = false;
+
+static void *SoundLoaderMain(void *arg)
+{
+    (void)arg;
+    TRACE_THREAD("sound loader");
+    for (int i = 0; i < soundLoadCount; i++)
+    {
+        soundLoads[i].wave = RenderPatchWave(soundLoads[i].patch);
+        atomic_store(&soundLoads[i].decoded, true);
+    }
+    return NULL;
+}
+
+#endif
+
+// Native builds render in the background: the Sounds stay zeroed until PumpSoundLoads
+// uploads them, and raylib ignores PlaySound on those, so early effects are just skipped.
+// The threaded web build renders them in parallel and only uploads on the main thread.
+void LoadSounds(const FmPatch *patches, Sound **sounds, int count)
+{
+#if defined(__EMSCRIPTEN_PTHREADS__)
+    SoundDecode jobs[count];
+    for (int i = 0; i < count; i++) jobs[i] = (SoundDecode){ .patch = &patches[i] };
 
-            block->active    = true;
-            block->fadeAlpha = 0.0f;
+    decodeJobs  = jobs;
+    decodeCount = count;
+    atomic_store(&decodeNext, 0);
+
+    pthread_t workers[DECODE_THREADS];
+    int started = 0;
+    while (started < DECODE_THREADS && started < count && pthread_create(&workers[started], NULL, DecodeWorker, NULL) == 0) started++;
+    DecodeWorker(NULL);   // help out, and finish alone if no worker could start
+    for (int i = 0; i < started; i++) pthread_join(workers[i], NULL);
+
+    for (int i = 0; i < count; i++)
+    {
+        *sounds[i] = LoadSoundFromWave(jobs[i].wave);
+        MemStatsTrackSound(patches[i].name, *sounds[i]);
+        UnloadWave(jobs[i].wave);
+    }
+#elif defined(PLATFORM_WEB)
+    for (int i = 0; i < count; i++)
+    {
+        Wave wave = RenderPatchWave(&patches[i]);
+        *sounds[i] = LoadSoundFromWave(wave);
+        MemStatsTrackSound(patches[i].name, *sounds[i]);
+        UnloadWave(wave);
+    }
+#else
+    soundLoadCount    = (count < MAX_SOUNDS) ? count : MAX_SOUNDS;
+    soundLoadsPending = soundLoadCount;
+    for (int i = 0; i < soundLoadCount; i++)
+    {
+        *sounds[i] = (Sound){ 0 };
+        soundLoads[i] = (SoundLoad){ .patch = &patches[i], .sound = sounds[i] };
+        atomic_init(&soundLoads[i].decoded, false);
+    }
+
+    soundLoaderRunning = (pthread_create(&soundLoader, NULL, SoundLoaderMain, NULL) == 0);
+    if (!soundLoaderRunning)
+    {
+        SoundLoaderMain(NULL);   // no thread: render now, upload on the first pump
+    }
+#endif
+}
+
+// Native: uploads at most one decoded sound per call (LoadSoundFromWave converts and copies
+// the whole wave), so a frame never waits on more than one. Called every frame.
+void PumpSoundLoads(void)
+{
+#if !defined(PLATFORM_WEB)
+    if (soundLoadsPending == 0) return;
+
+    for (int i = 0; i < soundLoadCount; i++)
+    {
+        SoundLoad *load = &soundLoads[i];
+        if (load->uploaded || !atomic_load(&load->decoded)) continue;
+
+        *load->sound = LoadSoundFromWave(load->wave);
+        MemStatsTrackSound(load->patch->name, *load->sound);
+        UnloadWave(load->wave);
+        load->uploaded = true;
+        soundLoadsPending--;
+        break;
+    }
+
+    if (soundLoadsPending == 0 && soundLoaderRunning)
+    {
+        pthread_join(soundLoader, NULL);
+        soundLoaderRunning = false;
+        TraceLog(LOG_INFO, "AUDIO: %d sounds loaded in the background", soundLoadCount);
+    }
+#endif
+}
+
+// Native: waits for the loader so quitting early doesn't race it; waves that never got
+// uploaded are dropped
+void FinishSoundLoads(void)
+{
+#if !defined(PLATFORM_WEB)
+    if (soundLoaderRunning) pthread_join(soundLoader, NULL);
+    soundLoaderRunning = false;
+
+    for (int i = 0; i < soundLoadCount; i++)
+    {
+        if (!soundLoads[i].uploaded && atomic_load(&soundLoads[i].decoded)) UnloadWave(soundLoads[i].wave);
+        soundLoads[i].uploaded = true;
+    }
+    soundLoadsPending = 0;
+#endif
+}
+
+// Allocates the HUD layer at the framebuffer's resolution so text stays crisp on high-DPI
+void LoadHud(void)
+{
+    hud.target = LoadRenderTexture(SCREEN_WIDTH * renderScale, SCREEN_HEIGHT * renderScale);
+    MemStatsTrackRenderTexture("hud", hud.target);
+    hud.score  = -1; // force the first redraw
+}
+
+// Redraws the cached HUD layer if anything on it changed, then blits it
+void DrawHud(Font font, const GameState *gs)
+{
+    if (gs->score != hud.score || pbScore != hud.pbScore || gs->invincibleCount != hud.invincibleCount)
+    {
+        hud.score           = gs->score;
+        hud.pbScore         = pbScore;
+        hud.invincibleCount = gs->invincibleCount;
+
+        BeginTextureMode(hud.target);
+        ClearBackground(BLANK);
+        BeginMode2D((Camera2D){ .zoom = renderScale });
+
+        // Keep color premultiplied and coverage correct when drawing onto transparent pixels
+        rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+        BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+
+        // Invincible indicator (bottom-left)
+        for (int i = 0; i < INVINCIBLE_CHARGES; i++)
+        {
+            Color invincibleColor = (i < hud.invincibleCount) ? Fade(WHITE, 0.5f) : Fade(DARKGRAY, 0.3f);
+            DrawCircle(30 + (i * 20), SCREEN_HEIGHT - 30, 6, invincibleColor);
         }
 
-        // Ensure at least one breakable block in each row
-        if (!hasBreakableBlock)
+        // Score text
+        char scoreText[32];
+        sprintf(scoreText, "Score: %d", hud.score);
+
+        // Measure text size
+        Vector2 scoreTextSize = MeasureTextEx(font, scoreText, 20, 1);
+        float padding = 10.0f;
+        Rectangle scoreBackground = {
+            10, 10,
+            scoreTextSize.x + padding * 2,
+            scoreTextSize.y + padding * 2
+        };
+
+        // Translucent background
+        DrawRectangleRec(scoreBackground, Fade(LIGHTGRAY, 0.3f));
+        DrawTextEx(font, scoreText, (Vector2){ scoreBackground.x + padding, scoreBackground.y + padding }, 20, 1, WHITE);
+
+        // PB Score (top-right)
+        if (hud.pbScore > 0)
         {
-            int col = GetRandomValue(0, thickness - 1);
-            Block *block = &wall->blocks[row][col];
-            block->breakable = true;
+            char pbScoreText[32];
+            sprintf(pbScoreText, "PB: %d", hud.pbScore);
+            Vector2 pbScoreTextSize = MeasureTextEx(font, pbScoreText, 20, 1);
 
-            if (GetRandomValue(1, 100) <= 5)
-            {
-                block->letter = '0' + GetRandomValue(0, 9);
-            }
-            else
-            {
-                // Avoid W or S if possible
-                do {
-                    block->letter = 'A' + GetRandomValue(0, 25);
-                } while (block->letter == 'W' || block->letter == 'S');
-            }
-            block->active = true;
+            Rectangle pbScoreBackground = {
+                SCREEN_WIDTH - 110, 10,
+                100, 40
+            };
+            DrawRectangleRec(pbScoreBackground, Fade(GOLD, 0.5f));
+            DrawTextEx(font, pbScoreText,
+                    (Vector2){
+                    pbScoreBackground.x + (pbScoreBackground.width  - pbScoreTextSize.x) / 2,
+                    pbScoreBackground.y + (pbScoreBackground.height - pbScoreTextSize.y) / 2
+                    },
+                    20, 1, BLACK);
         }
+
+        EndBlendMode();
+        EndMode2D();
+        EndTextureMode();
+    }
+
+    // Render textures are stored upside down
+    Rectangle source = { 0, 0, hud.target.texture.width, -hud.target.texture.height };
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    DrawTexturePro(hud.target.texture, source, (Rectangle){ 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT }, (Vector2){ 0, 0 }, 0.0f, WHITE);
+    EndBlendMode();
+}
+
+// Renders at the display refresh rate (or a fixed 60 FPS); the simulation rate never changes
+void ApplyFrameRateMode(void)
+{
+    int refreshRate = GetMonitorRefreshRate(GetCurrentMonitor());
+    if (refreshRate <= 0) refreshRate = 60; // unknown (e.g. web), let vsync pace it
+
+    SetTargetFPS(matchDisplayRate ? refreshRate : 60);
+}
+
+// Throttles rendering on screens where nothing needs 60+ FPS, and snaps back on input
+void UpdatePowerMode(bool idleScreen)
+{
+    // Only peek at the key queue on idle screens, gameplay counts keystrokes from it
+    bool input = (GetMouseDelta().x != 0 || GetMouseDelta().y != 0 || IsMouseButtonPressed(MOUSE_BUTTON_LEFT));
+    if (idleScreen && GetKeyPressed() != 0) input = true;
+    if (input || !idleScreen) lastInputTime = GetTime();
+
+    PowerMode mode = POWER_FULL;
+    if (idleScreen && !IsWindowFocused())                               mode = POWER_WAIT;
+    else if (idleScreen && GetTime() - lastInputTime > IDLE_GRACE_TIME) mode = POWER_IDLE;
+
+#ifdef PLATFORM_WEB
+    if (mode == POWER_WAIT) mode = POWER_IDLE; // the browser already throttles hidden tabs
+#endif
+
+    if (mode == powerMode) return;
+
+    if (powerMode == POWER_WAIT) DisableEventWaiting();
+
+    switch (mode)
+    {
+        case POWER_FULL: ApplyFrameRateMode();  break;
+        case POWER_IDLE: SetTargetFPS(IDLE_FPS); break;
+        case POWER_WAIT: SetTargetFPS(IDLE_FPS); EnableEventWaiting(); break;
     }
+    powerMode = mode;
+}
+
+// Accounts for copies of GameState, split into the particle pool, wall pool and the rest
+void TrackGameStates(const char *owner, size_t copies)
+{
+    char   name[32];
+    size_t particles = sizeof(((GameState *)0)->particles);
+    size_t walls     = sizeof(((GameState *)0)->walls);
+
+    snprintf(name, sizeof(name), "%s particles", owner);
+    MemStatsTrack(MEM_SIMULATION, name, copies * particles, 0);
+    snprintf(name, sizeof(name), "%s walls", owner);
+    MemStatsTrack(MEM_SIMULATION, name, copies * walls, 0);
+    snprintf(name, sizeof(name), "%s state", owner);
+    MemStatsTrack(MEM_SIMULATION, name, copies * (sizeof(GameState) - particles - walls), 0);
+}
+
+// Plays the sounds for everything the simulation reported. Score and combo climb a
+// semitone per point through each octave; breaks are detuned a little so runs of them
+// don't sound like one sample.
+void PlaySimEvents(uint32_t events, int score)
+{
+    TRACE_ZONE("PlaySimEvents");
+    float scorePitch = exp2f((score % 12) / 12.0f);
+
+    if (events & SIM_EVENT_CRASH)         PlaySound(crashSound);
+    if (events & SIM_EVENT_BLACK_HOLE)    PlaySound(blackHoleSound);
+    if (events & SIM_EVENT_BLOCK_DESTROY)
+    {
+        SetSoundPitch(blockDestroy, 1.0f + GetRandomValue(-4, 4) / 100.0f);
+        PlaySound(blockDestroy);
+    }
+    if (events & SIM_EVENT_WARP)          PlaySound(warpSound);
+    if (events & SIM_EVENT_SCORE_UP)
+    {
+        SetSoundPitch(scoreUpSound, scorePitch);
+        PlaySound(scoreUpSound);
+    }
+    if (events & SIM_EVENT_COMBO)
+    {
+        SetSoundPitch(comboSound, scorePitch);
+        PlaySound(comboSound);
+    }
+    if (events & SIM_EVENT_JAMMED)        PlaySound(blackHoleSound);
+}
+
+// Collects this frame's typeable key presses as GameInput.pressed bits
+uint64_t PollGameKeys(void)
+{
+    uint64_t pressed = 0;
+
+    for (int k = KEY_A; k <= KEY_Z; k++)
+    {
+        if (IsKeyPressed(k)) pressed |= InputKeyBit((char)k);
+    }
+    for (int k = KEY_ZERO; k <= KEY_NINE; k++)
+    {
+        if (IsKeyPressed(k)) pressed |= InputKeyBit((char)k);
+    }
+    if (IsKeyPressed(KEY_SPACE)) pressed |= INPUT_WARP;
+
+    return pressed;
+}
+
+// Stores a run in the save store (once per run, skipped if nothing was played).
+// Returns true the one time it does.
+bool RecordSession(const GameState *gs, DeathCause cause)
+{
+    if (sessionRecorded || gs->runId != runId || gs->playTime <= 0.0f) return false;
+
+    SaveStoreAppend((SessionRecord){
+        .score      = gs->score,
+        .duration   = gs->playTime,
+        .keystrokes = sessionKeystrokes,
+        .cause      = cause,
+    });
+    sessionRecorded = true;
+    return true;
+}
+
+// Points the simulation at the walls the menu picked; returns the next run's seed
+uint32_t PrepareNextRun(void)
+{
+    uint32_t seed   = (uint32_t)time(NULL) ^ (runId * 0x9E3779B9u);
+    int      levels = PatternLevelCount();
+    int      level  = (wallSource >= 0 && wallSource < levels) ? wallSource : -1;
+
+    // Daily: without a library it's still a shared seed for the random walls
+    if (wallSource == WALLS_DAILY)
+    {
+        uint32_t day = (uint32_t)(time(NULL) / 86400);
+        seed  = day;
+        level = levels ? (int)(day % levels) : -1;
+    }
+
+    SimRunnerSetPatternLevel(level);
+    return seed;
 }
 
 // Resets the game state for a new round
-void ResetGameState(Wall walls[], Vector2 *playerPosition, int *score, float *wallSpeed, bool *gameOver, bool *gameOverTriggered, int *invincibleCount)
+void ResetGameState(void)
 {
     StopSound(crashSound);
 
-    // Reset player
-    playerPosition->y = SCREEN_HEIGHT / 2;
-    playerPosition->x = 50;
+    // The simulation picks the request up on its next tick
+    runId = SimRunnerRequestReset(PrepareNextRun());
+
+    // Start a fresh session
+    sessionKeystrokes = 0;
+    sessionRecorded   = false;
 
-    // Reset other parameters
-    *invincibleCount        = 2;
-    *score            = 0;
-    *wallSpeed        = 200;
-    *gameOver         = false;
-    *gameOverTriggered= false;
+    PlaySound(startSound);
+}
 
-    // Reset screen shake effects
-    screenShake = 0.0f;
-    shakeOffset = (Vector2){0, 0};
+// Knob settings for one step of a sweep; each sweep ramps one knob from the baseline.
+// Returns false past the last step.
+bool StressKnobsForStep(int sweep, int step, StressKnobs *knobs, const char **name, float *value)
+{
+    *knobs = (StressKnobs){ .wallCount = WALL_COUNT, .thickness = 2, .burstSize = 10, .letterPercent = 80 };
 
-    // Reset walls
-    for (int i = 0; i < WALL_COUNT; i++)
+    switch (sweep)
     {
-        GenerateWall(&walls[i], SCREEN_WIDTH + i * 300, 2, *score);
-        walls[i].scored = false;
+        case 0:
+            if (step > 6) return false;
+            *name = "walls";     *value = knobs->wallCount = 1 << step;              // 1 .. 64
+            break;
+        case 1:
+            if (step > 15) return false;
+            knobs->wallCount = 4;
+            *name = "thickness"; *value = knobs->thickness = 1 + step * 2;           // 1 .. 31
+            break;
+        case 2:
+            if (step > 8) return false;
+            *name = "particles"; *value = knobs->burstSize = 10 << step;             // 10 .. 2560 per burst
+            break;
+        case 3:
+            if (step > 5) return false;
+            *name = "blackhole"; *value = knobs->blackHoleFraction = step / 5.0f;    // never .. always
+            break;
+        case 4:
+            if (step > 5) return false;
+            knobs->wallCount = 8;
+            knobs->thickness = 4;
+            *name = "letters";   *value = knobs->letterPercent = step * 20;          // 0 .. 100 %
+            break;
+        default:
+            return false;
     }
+    return true;
+}
 
-    PlaySound(startSound);
+static int CompareFloats(const void *a, const void *b)
+{
+    float x = *(const float *)a, y = *(const float *)b;
+    return (x > y) - (x < y);
+}
+
+// Sweeps every knob of the stress scene, measuring frame times at each step, and writes
+// one CSV row per step: the scalability curve of each draw subsystem
+void RunStressTest(Font font)
+{
+    static Block    blocks[STRESS_MAX_WALLS][WALL_ROWS][STRESS_MAX_THICKNESS];
+    static Particle particles[STRESS_MAX_PARTICLES];
+    static float    frameTimes[STRESS_MEASURE_FRAMES];
+    static GameState noEffects;   // EndScene with no flash or trails
+
+    FILE *csv = fopen(STRESS_OUTPUT_FILE, "w");
+    if (!csv)
+    {
+        TraceLog(LOG_WARNING, "STRESS: Can't write %s", STRESS_OUTPUT_FILE);
+        return;
+    }
+    fprintf(csv, "subsystem,value,blocks,particles,fps,ms_p50,ms_p95,ms_p99\n");
+
+    // Measure how fast we can go, not how fast the display refreshes
+    ClearWindowState(FLAG_VSYNC_HINT);
+    SetTargetFPS(0);
+    SetRandomSeed(0xDEAD);
+
+    StressKnobs knobs;
+    const char *name;
+    float       value;
+
+    for (int sweep = 0; !WindowShouldClose(); sweep++)
+    {
+        if (!StressKnobsForStep(sweep, 0, &knobs, &name, &value)) break;
+
+        for (int step = 0; StressKnobsForStep(sweep, step, &knobs, &name, &value) && !WindowShouldClose(); step++)
+        {
+            // Fresh walls for this step
+            for (int w = 0; w < knobs.wallCount; w++)
+            {
+                for (int row = 0; row < WALL_ROWS; row++)
+                {
+                    for (int col = 0; col < knobs.thickness; col++)
+                    {
+                        Block *block = &blocks[w][row][col];
+                        block->breakable = GetRandomValue(1, 100) <= knobs.letterPercent;
+                        block->letter    = block->breakable ? 'A' + GetRandomValue(0, 25) : '\0';
+                        if (block->breakable && GetRandomValue(1, 100) == 1) block->letter = '0';
+                        block->rect      = (Rectangle){ 0, row * BLOCK_SIZE, BLOCK_SIZE, BLOCK_SIZE };
+                        block->active    = true;
+                    }
+                }
+            }
+            memset(particles, 0, sizeof(particles));
+
+            int   particleIndex = 0;
+            int   frames        = 0;
+            int   liveParticles = 0;
+            float burstTimer    = 0.0f;
+            float stepTime      = 0.0f;
+            float spacing       = (float)(SCREEN_WIDTH + knobs.thickness * BLOCK_SIZE) / knobs.wallCount;
+
+            while (frames < STRESS_MEASURE_FRAMES && !WindowShouldClose())
+            {
+                float deltaTime = GetFrameTime();
+                stepTime += deltaTime;
+                if (stepTime > STRESS_WARMUP_TIME) frameTimes[frames++] = deltaTime;
+
+                // Scroll the walls
+                for (int w = 0; w < knobs.wallCount; w++)
+                {
+                    float x = fmodf(w * spacing - stepTime * 100.0f, SCREEN_WIDTH + knobs.thickness * BLOCK_SIZE);
+                    if (x < -knobs.thickness * BLOCK_SIZE) x += SCREEN_WIDTH + knobs.thickness * BLOCK_SIZE;
+
+                    for (int row = 0; row < WALL_ROWS; row++)
+                    {
+                        for (int col = 0; col < knobs.thickness; col++) blocks[w][row][col].rect.x = x + col * BLOCK_SIZE;
+                    }
+                }
+
+                // Particle bursts, updated like the game's
+                burstTimer += deltaTime;
+                if (burstTimer >= STRESS_BURST_INTERVAL)
+                {
+                    burstTimer = 0.0f;
+                    Vector2 origin = { GetRandomValue(0, SCREEN_WIDTH), GetRandomValue(0, SCREEN_HEIGHT) };
+                    Color   color  = GetBlockColor('A' + GetRandomValue(0, 25));
+                    for (int i = 0; i < knobs.burstSize; i++)
+                    {
+                        float angle = GetRandomValue(0, 360) * DEG2RAD;
+                        float speed = GetRandomValue(30, 60) / 10.0f;
+                        particles[particleIndex] = (Particle){ origin, { cosf(angle) * speed, sinf(angle) * speed },
+                                                               0.8f, GetRandomValue(3, 5), color };
+                        particleIndex = (particleIndex + 1) % STRESS_MAX_PARTICLES;
+                    }
+                }
+
+                liveParticles = 0;
+                for (int i = 0; i < STRESS_MAX_PARTICLES; i++)
+                {
+                    Particle *particle = &particles[i];
+                    if (particle->lifetime <= 0) continue;
+
+                    particle->position.x += particle->velocity.x * deltaTime * 60;
+                    particle->position.y += particle->velocity.y * deltaTime * 60;
+                    particle->velocity.y += 3.0f * deltaTime;
+                    particle->lifetime   -= deltaTime;
+                    liveParticles++;
+                }
+
+                bool blackHole = fmodf(stepTime, 2.0f) < knobs.blackHoleFraction * 2.0f;
+
+                BeginDrawing();
+                BeginScene();
+                if (blackHole) DrawDistortedGrid(5.0f, 50, DARKGREEN, (Vector2){ SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 });
+                DrawMovingGrid(10.0f, 40, DARKGREEN);
+
+                for (int w = 0; w < knobs.wallCount; w++)
+                {
+                    for (int row = 0; row < WALL_ROWS; row++)
+                    {
+                        for (int col = 0; col < knobs.thickness; col++) DrawBlock(font, &blocks[w][row][col]);
+                    }
+                }
+
+                DrawParticleArray(particles, STRESS_MAX_PARTICLES);
+                EndScene(&noEffects);
+
+                char status[96];
+                sprintf(status, "STRESS %s = %g  (%d FPS)", name, value, GetFPS());
+                DrawRectangle(10, 10, 360, 30, Fade(BLACK, 0.7f));
+                DrawTextEx(font, status, (Vector2){ 20, 16 }, 18, 1, YELLOW);
+                EndDrawing();
+            }
+
+            if (frames == 0) break;
+
+            // Percentiles of this step's frame times
+            float total = 0.0f;
+            for (int i = 0; i < frames; i++) total += frameTimes[i];
+            qsort(frameTimes, frames, sizeof(float), CompareFloats);
+
+            int blockCount = knobs.wallCount * WALL_ROWS * knobs.thickness;
+            fprintf(csv, "%s,%g,%d,%d,%.1f,%.3f,%.3f,%.3f\n", name, value, blockCount, liveParticles,
+                    frames / total, frameTimes[frames / 2] * 1000.0f,
+                    frameTimes[frames * 95 / 100] * 1000.0f, frameTimes[frames * 99 / 100] * 1000.0f);
+            TraceLog(LOG_INFO, "STRESS: %s = %g: %.1f FPS, p99 %.2f ms", name, value,
+                    frames / total, frameTimes[frames * 99 / 100] * 1000.0f);
+        }
+    }
+
+    fclose(csv);
+    TraceLog(LOG_INFO, "STRESS: Results written to %s", STRESS_OUTPUT_FILE);
 }
 
 /*******************************************************************************************
 *  MAIN FUNCTION
 *******************************************************************************************/
 
-int main()
+int main(int argc, char **argv)
 {
+    // Command line: --host <port> / --join <address>:<port> for versus, --stress for the render sweep
+    for (int i = 1; i < argc; i++)
+    {
+        const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if      (!strcmp(argv[i], "--host") && value) NetSessionHost(atoi(value));
+        else if (!strcmp(argv[i], "--join") && value) NetSessionJoin(value);
+        else if (!strcmp(argv[i], "--stress"))        stressMode = true;
+    }
+
     // Initialization
     SetConfigFlags(FLAG_VSYNC_HINT | FLAG_MSAA_4X_HINT);
     SetConfigFlags(FLAG_WINDOW_HIGHDPI);
     InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "0xDEAD//TYPE");
+    TRACE_THREAD("main");
     SetExitKey(0);
-    SetTargetFPS(60);
+    ApplyFrameRateMode();
+    MemStatsInit();
 
     // Load custom font
     Font font = LoadFont("assets/vcr.ttf");
+    MemStatsTrackFont("vcr.ttf", font);
+
+    // Anything outside the baked ASCII set is rasterized on first use
+    if (!GlyphCacheOpen("assets/vcr.ttf")) TraceLog(LOG_WARNING, "GLYPHS: No glyph cache, word labels won't draw");
 
     // Audio device init
     InitAudioDevice();
-    crashSound     = LoadSound("assets/crash.wav");
-    blackHoleSound = LoadSound("assets/blackhole.wav");
-    blockDestroy   = LoadSound("assets/blockDestroy.wav");
-    pauseSound     = LoadSound("assets/pause.wav");
-    warpSound      = LoadSound("assets/warp.wav");
-    scoreUpSound   = LoadSound("assets/scoreup.wav");
-    startSound     = LoadSound("assets/start.wav");
-    comboSound     = LoadSound("assets/combo.wav");
-
-    // Player initialization
-    Vector2 playerPosition = { 50, SCREEN_HEIGHT / 2 }; // Triangle center position
-    float   playerSpeedY   = 200;
-    float   playerSize     = 20.0f; // Size of the spaceship triangle
-
-    // Wall initialization
-    Wall walls[WALL_COUNT];
-    for (int i = 0; i < WALL_COUNT; i++)
-    {
-        GenerateWall(&walls[i], SCREEN_WIDTH + i * 300, 2, score);
-    }
+    Sound *soundSlots[] = {    // in soundPatches order
+        &crashSound, &blackHoleSound, &blockDestroy, &pauseSound,
+        &warpSound, &scoreUpSound, &startSound, &comboSound,
+    };
+    LoadSounds(soundPatches, soundSlots, sizeof(soundSlots) / sizeof(soundSlots[0]));
+
+    // Personal best & session history
+    SaveStoreOpen();
+
+    // Opt-in tuning telemetry, fed straight from the simulation thread
+    if (TelemetryOpen(SaveStoreGetDir())) simTelemetrySink = TelemetryPush;
+
+    // Opt-in online leaderboard, sent in the background
+    LeaderboardOpen(SaveStoreGetDir());
+
+    renderScale = (float)GetRenderWidth() / GetScreenWidth();
+    LoadPostFx();
+    LoadHud();
+
+    // Curated walls for challenge and daily runs, mapped rather than loaded
+    if (PatternLibraryOpen("assets/walls.dtw")) TraceLog(LOG_INFO, "PATTERNS: %d levels mapped", PatternLevelCount());
+    else                                        TraceLog(LOG_INFO, "PATTERNS: No wall library, challenge levels off");
+
+    // Simulation runs at a fixed tick rate, on its own thread where available
+    runId = SimRunnerStart((uint32_t)time(NULL));
+    TrackGameStates("runner", SIM_RUNNER_STATE_COPIES);
+    TrackGameStates("render", 2);
+    if (NetSessionActive()) TrackGameStates("versus", NET_STATE_COPIES);
+
+    // Rendering stress sweep instead of the game
+    if (stressMode) RunStressTest(font);
 
     // Game Loop
-    while (!WindowShouldClose())
+    while (!stressMode && !WindowShouldClose())
     {
+        TRACE_ZONE("frame");
         float deltaTime = GetFrameTime();
 
+        if (IsKeyPressed(KEY_F3)) showMemStats = !showMemStats;
+        if (IsKeyPressed(KEY_F4)) TRACE_FLUSH(SaveStoreGetDir());
+
+        // A few queued glyphs per frame, before anything is drawn with the atlas
+        GlyphCacheUpdate();
+
+        // Sounds still arriving from the loader thread (native)
+        PumpSoundLoads();
+
+        // Drop the frame rate on idle screens and when unfocused, but never while a versus
+        // session is up: the net pump has to keep running or the peer times out
+        UpdatePowerMode(!NetSessionActive() && (inMainMenu || paused || !IsWindowFocused()));
+
+        // Pick up the stored PB (arrives a few frames late on web)
+        SaveStorePump();
+        LeaderboardPump();
+        if (SaveStoreGetBest() > pbScore) pbScore = SaveStoreGetBest();
+
+        bool versus = NetSessionActive();
+
         // MAIN MENU
         if (inMainMenu)
         {
-            // Check for spacebar to start the game
-            if (IsKeyPressed(KEY_SPACE))
+            TRACE_ZONE("menu");
+            // Check for spacebar to start the game (versus starts once the opponent is there)
+            if (versus) NetSessionPump(deltaTime, 0, false, false);
+            if (versus ? NetSessionConnected() : IsKeyPressed(KEY_SPACE))
             {
                 inMainMenu = false;
                 PlaySound(startSound);
             }
+            SimRunnerSetActive(false);
             // Toggle sound
             if (IsKeyPressed(KEY_M))
             {
@@ -544,9 +1246,39 @@ int main()
                 if (!soundEnabled) SetMasterVolume(0.0f); // Mute all audio
                 else               SetMasterVolume(1.0f); // Restore audio
             }
+            // Toggle frame rate mode
+            if (IsKeyPressed(KEY_F))
+            {
+                matchDisplayRate = !matchDisplayRate;
+                ApplyFrameRateMode();
+            }
+            // Toggle word mode (a race always uses letters); the waiting run is regenerated
+            if (IsKeyPressed(KEY_T) && !versus)
+            {
+                wordMode = !wordMode;
+                SimRunnerSetWordMode(wordMode);
+                runId = SimRunnerRequestReset(PrepareNextRun());
+            }
+            // Cycle the wall source: random, daily, then each level of the pattern library
+            if (IsKeyPressed(KEY_L) && !versus)
+            {
+                if      (wallSource == WALLS_RANDOM)              wallSource = WALLS_DAILY;
+                else if (wallSource == WALLS_DAILY)               wallSource = PatternLevelCount() ? 0 : WALLS_RANDOM;
+                else if (wallSource + 1 < PatternLevelCount())    wallSource++;
+                else                                              wallSource = WALLS_RANDOM;
+                runId = SimRunnerRequestReset(PrepareNextRun());
+            }
 
             char soundText[100];
             sprintf(soundText, "Sound: %s (Press M)", soundEnabled ? "ON" : "OFF");
+            char frameRateText[100];
+            sprintf(frameRateText, "Frame rate: %s (Press F)", matchDisplayRate ? "DISPLAY" : "60 FPS");
+            char modeText[100];
+            sprintf(modeText, "Mode: %s (Press T)", wordMode ? "WORDS" : "LETTERS");
+            char wallsText[100];
+            if      (wallSource == WALLS_RANDOM) sprintf(wallsText, "Walls: RANDOM (Press L)");
+            else if (wallSource == WALLS_DAILY)  sprintf(wallsText, "Walls: DAILY #%u (Press L)", (unsigned)(time(NULL) / 86400));
+            else                                 sprintf(wallsText, "Walls: %s (Press L)", PatternLevelName(wallSource));
 
             BeginDrawing();
             ClearBackground(BACKGROUND);
@@ -556,18 +1288,22 @@ int main()
 
             // Centered title and instructions
             Vector2 titleSize       = MeasureTextEx(font, "0xDEAD//TYPE", 40, 1);
-            Vector2 instructionSize = MeasureTextEx(font, "Press SPACE to Start", 20, 1);
+            const char *instructionText = versus ? "Waiting for opponent..." : "Press SPACE to Start";
+            Vector2 instructionSize = MeasureTextEx(font, instructionText, 20, 1);
             Vector2 controlsSize    = MeasureTextEx(font, "Controls:", 25, 1);
             Vector2 moveSize        = MeasureTextEx(font, "Move: W/S or Up/Down", 18, 1);
             Vector2 invincibleSize   = MeasureTextEx(font, "Invincibility: SPACE", 18, 1);
             Vector2 pauseSize       = MeasureTextEx(font, "Pause: ESC", 18, 1);
             Vector2 soundTextSize   = MeasureTextEx(font, soundText, 20, 1);
+            Vector2 frameRateSize   = MeasureTextEx(font, frameRateText, 20, 1);
+            Vector2 modeSize        = MeasureTextEx(font, modeText, 20, 1);
+            Vector2 wallsSize       = MeasureTextEx(font, wallsText, 20, 1);
 
             DrawTextEx(font, "0xDEAD//TYPE",
                     (Vector2){(SCREEN_WIDTH - titleSize.x) / 2, (SCREEN_HEIGHT - titleSize.y) / 2 - 50},
                     40, 1, WHITE);
 
-            DrawTextEx(font, "Press SPACE to Start",
+            DrawTextEx(font, instructionText,
                     (Vector2){(SCREEN_WIDTH - instructionSize.x) / 2, (SCREEN_HEIGHT - instructionSize.y) / 2 + 20},
                     20, 1, GRAY);
 
@@ -579,6 +1315,20 @@ int main()
                     (Vector2){(SCREEN_WIDTH - soundTextSize.x) / 2, (SCREEN_HEIGHT - soundTextSize.y) - 10 },
                     20, 1, GRAY);
 
+            DrawTextEx(font, frameRateText,
+                    (Vector2){(SCREEN_WIDTH - frameRateSize.x) / 2, (SCREEN_HEIGHT - soundTextSize.y) - 35 },
+                    20, 1, GRAY);
+
+            if (!versus)
+            {
+                DrawTextEx(font, modeText,
+                        (Vector2){(SCREEN_WIDTH - modeSize.x) / 2, (SCREEN_HEIGHT - soundTextSize.y) - 60 },
+                        20, 1, GRAY);
+                DrawTextEx(font, wallsText,
+                        (Vector2){(SCREEN_WIDTH - wallsSize.x) / 2, (SCREEN_HEIGHT - soundTextSize.y) - 85 },
+                        20, 1, GRAY);
+            }
+
             DrawTextEx(font, "Controls:", 
                     (Vector2){(SCREEN_WIDTH - controlsSize.x) / 2, controlsStartY}, 
                     25, 1, LIGHTGRAY);
@@ -599,275 +1349,103 @@ int main()
                     (Vector2){(SCREEN_WIDTH - quitSize.x) / 2, controlsStartY + 115}, 
                     18, 1, GRAY); */
 
+            if (showMemStats) MemStatsDraw(font);
             EndDrawing();
             continue;
         }
 
-        // GAME CONTROLS: invincible, pause, etc.
-        if (IsKeyPressed(KEY_SPACE) && invincibleCount > 0 && !paused && !gameOver)
-        {
-            PlaySound(warpSound);
-            invincibleCount--;
+        TRACE_BEGIN(update, "update");
+        int localPlayer = NetSessionLocalPlayer();
+        const GameState *gs = versus ? &NetSessionState()->players[localPlayer] : SimRunnerAcquireSnapshot();
 
-            // Activate invisibility
-            playerInvincible = true;
-            invisibilityEndTime = GetTime() + 5.0f;
-
-            // Store afterimage
-            afterimages[afterimageIndex] = (Afterimage){ playerPosition, 1.0f };
-            afterimageIndex = (afterimageIndex + 1) % MAX_AFTERIMAGES;
-        }
-
-        if (playerInvincible && GetTime() > invisibilityEndTime)
-        {
-            playerInvincible = false;
-        }
-
-        // Toggle pause with ESC
-        if (IsKeyPressed(KEY_ESCAPE) && !gameOver)
+        // Toggle pause with ESC (a race can't be paused)
+        if (IsKeyPressed(KEY_ESCAPE) && !gs->gameOver && !versus)
         {
             paused = !paused;
             PlaySound(pauseSound);
         }
 
-        if (!IsWindowFocused()) {
+        if (!IsWindowFocused() && !versus) {
             paused = true;
         }
 
-        // UPDATE & DRAW (if not paused)
-        if (!paused && !gameOver)
+        // Feed the simulation (it keeps ticking on game over so the explosion plays out)
+        uint64_t pressed = 0;
+        bool     up      = false;
+        bool     down    = false;
+        if (!paused && !gs->gameOver)
         {
-            // Player movement
-            if (IsKeyDown(KEY_W) || IsKeyDown(KEY_UP))   playerPosition.y -= playerSpeedY * deltaTime;
-            if (IsKeyDown(KEY_S) || IsKeyDown(KEY_DOWN)) playerPosition.y += playerSpeedY * deltaTime;
-
-            // Black Hole active
-            if (blackHoleActive)
-            {
-                ApplyScreenShake(2.0f);
-                DrawDistortedGrid(5.0f, 50, DARKGREEN, blackHolePos);
-
-                // Pull blocks in
-                for (int i = 0; i < WALL_COUNT; i++)
-                {
-                    for (int row = 0; row < SCREEN_HEIGHT / BLOCK_SIZE; row++)
-                    {
-                        for (int col = 0; col < walls[i].thickness; col++)
-                        {
-                            Block *block = &walls[i].blocks[row][col];
-                            if (!block->active) continue;
-
-                            Vector2 dir = { blackHolePos.x - block->rect.x, blackHolePos.y - block->rect.y };
-                            float distance = sqrtf(dir.x * dir.x + dir.y * dir.y);
-                            if (distance < 10)
-                            {
-                                block->active = false;
-                                continue;
-                            }
-
-                            // Normalize direction
-                            dir.x /= distance;
-                            dir.y /= distance;
-
-                            // Swirling motion
-                            float angle = GetTime() * 5.0f;
-                            Vector2 swirl = { cos(angle) * 5.0f, sin(angle) * 5.0f };
-
-                            // Move block
-                            block->rect.x += (dir.x * 3.0f + swirl.x) * 2.0f;
-                            block->rect.y += (dir.y * 3.0f + swirl.y) * 2.0f;
-                        }
-                    }
-                }
-
-                // Turn off Black Hole Mode after 1 second
-                if (GetTime() > blackHoleEndTime)
-                {
-                    blackHoleActive = false;
-                }
-            }
+            while (GetKeyPressed() != 0) sessionKeystrokes++;
 
-            // Keep player in screen bounds
-            if (playerPosition.y < playerSize)                      playerPosition.y = playerSize;
-            if (playerPosition.y > SCREEN_HEIGHT - playerSize)       playerPosition.y = SCREEN_HEIGHT - playerSize;
-
-            // Update anti-spam timers
-            if (keyPressCooldown > 0.0f) keyPressCooldown -= deltaTime;
-            if (wrongKeyFlash    > 0.0f) wrongKeyFlash    -= deltaTime;
-            if (bufferOverflow   > 0.0f) bufferOverflow   -= deltaTime;
-
-            // Adjust wall speed/thickness by score
-            wallSpeed = 100 + score * 2;
-            int newThickness = 2 + score / 10;
-            if (newThickness > 5) newThickness = 5;
-
-            // Track whether a block was destroyed this frame (for wrong-key detection)
-            bool blockDestroyedThisFrame  = false;
-            bool breakableBlockOnScreen   = false; // any typeable block currently visible
-
-            // Wall movement & collision
-            for (int i = 0; i < WALL_COUNT; i++)
-            {
-                walls[i].x -= wallSpeed * deltaTime;
-
-                if (walls[i].x + walls[i].thickness * BLOCK_SIZE < 0)
-                {
-                    GenerateWall(&walls[i], SCREEN_WIDTH, newThickness, score);
-                    walls[i].scored = false;
-                }
-
-                if (walls[i].active)
-                {
-                    for (int row = 0; row < SCREEN_HEIGHT / BLOCK_SIZE; row++)
-                    {
-                        for (int col = 0; col < walls[i].thickness; col++)
-                        {
-                            Block *block = &walls[i].blocks[row][col];
-                            block->rect.x = walls[i].x + col * BLOCK_SIZE;
-
-                            // Collision
-                            if (block->active)
-                            {
-                                if (!playerInvincible && CheckCollisionPointRec(playerPosition, block->rect))
-                                {
-                                    if (!gameOverTriggered)
-                                    {
-                                        gameOverTriggered = true;
-                                        playerCollisionPosition = playerPosition;
-                                        PlaySound(crashSound);
-                                        ApplyScreenShake(2.0f); // Stronger shake
-                                                                // Explosion particles
-                                        SpawnParticles(playerCollisionPosition, RED);
-                                    }
-                                    gameOver = true;
-                                }
-
-                                if (block->breakable)
-                                    breakableBlockOnScreen = true;
-
-                                // Break block if correct key pressed
-                                if (block->breakable && keyPressCooldown <= 0.0f && IsKeyPressed((int)block->letter))
-                                {
-                                    blockDestroyedThisFrame  = true;
-                                    block->fadeAlpha         = 1.0f; // Start fading
-                                    block->active            = false;
-
-                                    if (block->letter == '0')
-                                    {
-                                        blackHoleActive   = true;
-                                        blackHoleEndTime  = GetTime() + 1.0f;
-                                        PlaySound(blackHoleSound);
-                                    }
-                                    SpawnParticles(
-                                            (Vector2){
-                                            block->rect.x + BLOCK_SIZE / 2,
-                                            block->rect.y + BLOCK_SIZE / 2
-                                            },
-                                            GetBlockColor(block->letter)
-                                            );
-                                    PlaySound(blockDestroy);
-                                }
-                            }
-
-                            // Fade and shrink destroyed blocks
-                            if (!block->active && block->fadeAlpha > 0.0f)
-                            {
-                                block->fadeAlpha -= GetFrameTime() * 2.0f; // Fade speed
-                                float shrinkScale = block->fadeAlpha;
-                                float rotation    = (1.0f - block->fadeAlpha) * 360;
-
-                                DrawRotatingBlock(block->rect, Fade(GetBlockColor(block->letter), block->fadeAlpha), rotation, shrinkScale);
-                            }
-
-                            // Draw active blocks
-                            if (block->fadeAlpha > 0.0f)
-                            {
-                                DrawRectangleRec(block->rect, Fade(GetBlockColor(block->letter), block->fadeAlpha));
-                            }
-                        }
-                    }
-                }
-
-                // Score increment if player passes wall
-                if (!walls[i].scored && walls[i].x + walls[i].thickness * BLOCK_SIZE < playerPosition.x)
-                {
-                    if ((score + 1) % 5 == 0) {
-                        PlaySound(comboSound);
-                    } else {
-                    PlaySound(scoreUpSound);
-                    }
-                    score++;
-                    walls[i].scored = true;
-                }
-            }
+            pressed = PollGameKeys();
+            up      = IsKeyDown(KEY_W) || IsKeyDown(KEY_UP);
+            down    = IsKeyDown(KEY_S) || IsKeyDown(KEY_DOWN);
+        }
 
-            // Start cooldown after any successful key press (once per press, not per block)
-            if (blockDestroyedThisFrame) {
-                keyPressCooldown = KEY_COOLDOWN_TIME;
-                wrongKeyStreak   = 0;
-            }
+        if (versus)
+        {
+            NetSessionPump(deltaTime, pressed, up, down);
 
-            // Wrong-key detection: only penalise when there are blocks on screen to type
-            if (!blockDestroyedThisFrame && keyPressCooldown <= 0.0f && breakableBlockOnScreen)
-            {
-                bool badKeyPressed = false;
-                for (int k = KEY_A; k <= KEY_Z; k++)
-                {
-                    if (k == KEY_W || k == KEY_S) continue;
-                    if (IsKeyPressed(k)) { badKeyPressed = true; break; }
-                }
-                if (!badKeyPressed)
-                {
-                    for (int k = KEY_ZERO; k <= KEY_NINE; k++)
-                    {
-                        if (IsKeyPressed(k)) { badKeyPressed = true; break; }
-                    }
-                }
-                if (badKeyPressed)
-                {
-                    wrongKeyFlash    = 0.5f;   // brief red flash every wrong press
-                    wrongKeyStreak++;
-                    if (wrongKeyStreak >= 3)
-                    {
-                        bufferOverflow   = WRONG_KEY_LOCKOUT;
-                        keyPressCooldown = WRONG_KEY_LOCKOUT;
-                        wrongKeyStreak   = 0;
-                    }
-                }
-            }
+            NetSessionInterpolated(&frameState, localPlayer);
+            NetSessionInterpolated(&rivalState, 1 - localPlayer);
+            gs = &frameState;
+            PlaySimEvents(NetSessionTakeEvents(), gs->score);
+        }
+        else
+        {
+            if (!paused && !gs->gameOver) SimRunnerSubmitInput(pressed, up, down);
+            SimRunnerSetActive(!paused);
+            SimRunnerPump(deltaTime);
+
+            SimRunnerAcquireInterpolated(&frameState);
+            gs = &frameState;
+            PlaySimEvents(SimRunnerTakeEvents(), gs->score);
+            if (gs->gameOver && RecordSession(gs, gs->deathCause)) LeaderboardSubmit(gs);
         }
 
+        TRACE_END(update);
+
         // DRAW
-        UpdateScreenShake(deltaTime);
-        shakeOffset = GetScreenShakeOffset();
+        TRACE_BEGIN(draw, "draw");
+        shakeOffset = GetScreenShakeOffset(gs->screenShake);
 
         BeginDrawing();
-        Vector2 playerShakenPos = { playerPosition.x + shakeOffset.x, playerPosition.y + shakeOffset.y };
 
         if (!paused)
         {
-            ClearBackground(BACKGROUND);
+            // Gameplay goes offscreen; shake/flash/glow/trails are applied by EndScene
+            BeginScene();
+            if (gs->blackHoleActive) DrawDistortedGrid(5.0f, 50, DARKGREEN, gs->blackHolePos);
             DrawMovingGrid(10.0f, 40, DARKGREEN);
 
             // Player (if not gameOver)
-            if (!gameOver)
+            if (!gs->gameOver)
             {
-                // Rotation angle
-                float rotationAngle = (IsKeyDown(KEY_W) || IsKeyDown(KEY_UP))   ? -15 :
-                    (IsKeyDown(KEY_S) || IsKeyDown(KEY_DOWN)) ?  15 : 0;
-
-                // Afterimages
-                for (int i = 0; i < MAX_AFTERIMAGES; i++)
+                // Fade and shrink destroyed blocks
+                for (int i = 0; i < WALL_COUNT; i++)
                 {
-                    if (afterimages[i].alpha > 0.0f)
+                    if (!gs->walls[i].active) continue;
+
+                    for (int row = 0; row < WALL_ROWS; row++)
                     {
-                        afterimages[i].alpha -= GetFrameTime();
+                        for (int col = 0; col < gs->walls[i].thickness; col++)
+                        {
+                            const Block *block = &gs->walls[i].blocks[row][col];
+                            if (block->active || block->fadeAlpha <= 0.0f) continue;
+
+                            float shrinkScale = block->fadeAlpha;
+                            float rotation    = (1.0f - block->fadeAlpha) * 360;
+
+                            DrawRotatingBlock(block->rect, Fade(GetBlockColor(block->letter), block->fadeAlpha), rotation, shrinkScale);
+                            DrawRectangleRec(block->rect, Fade(GetBlockColor(block->letter), block->fadeAlpha));
+                        }
                     }
                 }
+
                     bool isBlinkVisible = true;
                     Color shipColor = GREEN;  // default
 
-                    if (playerInvincible)
+                    if (gs->playerInvincible)
                     {
                         // Blink cycle: 0.6s total, alternate color every 0.3s
                         float blinkCycle = fmod(GetTime(), 0.6f);
@@ -885,7 +1463,13 @@ int main()
 
                     if (isBlinkVisible)
                     {
-                        DrawRotatedTriangleWithGlow(playerShakenPos, playerSize, rotationAngle, shipColor);
+                        DrawRotatedTriangle(gs->playerPosition, PLAYER_SIZE, gs->rotation, shipColor);
+                    }
+
+                    // Opponent's ship as a ghost (their walls are the same seed, ours are what counts)
+                    if (versus && !rivalState.gameOver)
+                    {
+                        DrawRotatedTriangle(rivalState.playerPosition, PLAYER_SIZE, rivalState.rotation, Fade(RED, 0.5f));
                     }
 
             }
@@ -893,67 +1477,42 @@ int main()
             // Draw walls & blocks
             for (int i = 0; i < WALL_COUNT; i++)
             {
-                if (walls[i].active)
+                if (!gs->walls[i].active) continue;
+
+                for (int row = 0; row < WALL_ROWS; row++)
                 {
-                    for (int row = 0; row < SCREEN_HEIGHT / BLOCK_SIZE; row++)
+                    for (int col = 0; col < gs->walls[i].thickness; col++)
                     {
-                        for (int col = 0; col < walls[i].thickness; col++)
-                        {
-                            Block *block = &walls[i].blocks[row][col];
-                            if (block->active)
-                            {
-                                if (block->letter == '0')
-                                {
-                                    // Black hole block: rainbow color with letter
-                                    float hue = fmod(GetTime() * 400, 360);
-                                    Color rainbowColor = ColorFromHSV(hue, 0.9f, 0.9f);
-                                    DrawRectangleRec(block->rect, rainbowColor);
-                                    char letter[2] = { '0', '\0' };
-                                    Vector2 textSize = MeasureTextEx(font, letter, 20, 1);
-                                    float textX = block->rect.x + (block->rect.width  - textSize.x) / 2;
-                                    float textY = block->rect.y + (block->rect.height - textSize.y) / 2;
-                                    DrawTextEx(font, letter, (Vector2){ textX + 1, textY + 1 }, 22, 1, Fade(BLACK, 0.5f));
-                                    DrawTextEx(font, letter, (Vector2){ textX, textY }, 22, 1, BLACK);
-                                }
-                                else if (block->breakable)
-                                {
-                                    // Breakable block: draw with screen-shake offset + letter
-                                    Color blockColor = GetBlockColor(block->letter);
-                                    Rectangle shakenRect = block->rect;
-                                    shakenRect.x += shakeOffset.x;
-                                    shakenRect.y += shakeOffset.y;
-                                    DrawRectangleRec(shakenRect, blockColor);
-                                    char letter[2] = { block->letter, '\0' };
-                                    Vector2 textSize = MeasureTextEx(font, letter, 20, 1);
-                                    float textX = block->rect.x + (block->rect.width  - textSize.x) / 2;
-                                    float textY = block->rect.y + (block->rect.height - textSize.y) / 2;
-                                    Color textColor = ((blockColor.r + blockColor.g + blockColor.b) > 400) ? BLACK : WHITE;
-                                    DrawTextEx(font, letter, (Vector2){ textX + 1, textY + 1 }, 22, 1, Fade(BLACK, 0.5f));
-                                    DrawTextEx(font, letter, (Vector2){ textX, textY }, 22, 1, textColor);
-                                }
-                                else
-                                {
-                                    DrawPatternedBlock(block->rect, BLACK);
-                                    DrawRectangleLinesEx(block->rect, 0.5f, GREEN);
-                                }
-                            }
-                        }
+                        const Block *block = &gs->walls[i].blocks[row][col];
+                        if (block->active) DrawBlock(font, block);
                     }
                 }
+
+                if (gs->walls[i].wordLive) DrawWordLabels(gs, &gs->walls[i]);
             }
 
-            UpdateAndDrawParticles(deltaTime);
+            DrawParticles(gs);
+            EndScene(gs);
+
+            // Persistent Personal Best
+            if (gs->score > pbScore) pbScore = gs->score;
+
+            // Score, PB and invincible indicator (cached)
+            DrawHud(font, gs);
 
-            // Invincible indicator (bottom-left)
-            for (int i = 0; i < 2; i++)
+            // Opponent's score under ours
+            if (versus)
             {
-                Color invincibleColor = (i < invincibleCount) ? Fade(WHITE, 0.5f) : Fade(DARKGRAY, 0.3f);
-                DrawCircle(30 + (i * 20), SCREEN_HEIGHT - 30, 6, invincibleColor);
+                char rivalText[48];
+                if (NetSessionPeerLost()) sprintf(rivalText, "Rival: DISCONNECTED");
+                else                      sprintf(rivalText, "Rival: %d%s", rivalState.score, rivalState.gameOver ? " (dead)" : "");
+                DrawTextEx(font, rivalText, (Vector2){ 20, 60 }, 18, 1, Fade(RED, 0.8f));
             }
-            if (playerInvincible)
+
+            if (gs->playerInvincible)
 {
-    float timeLeft = invisibilityEndTime - GetTime();
-    float maxTime  = 5.0f;
+    float timeLeft = gs->invincibleTimeLeft;
+    float maxTime  = INVINCIBLE_DURATION;
     if (timeLeft < 0) timeLeft = 0;
 
     float barWidth  = 80;
@@ -971,53 +1530,8 @@ int main()
     DrawRectangleLines(barX, barY, barWidth, barHeight, GREEN);
 }
 
-            // Persistent Personal Best
-            static int pbScore = 0;
-            if (score > pbScore) pbScore = score;
-
-            // Score text
-            char scoreText[1000];
-            sprintf(scoreText, "Score: %d", score);
-
-            // Measure text size
-            Vector2 scoreTextSize = MeasureTextEx(font, scoreText, 20, 1);
-            float padding = 10.0f;
-            Rectangle scoreBackground = {
-                10, 10,
-                scoreTextSize.x + padding * 2,
-                scoreTextSize.y + padding * 2
-            };
-
-            // Translucent background
-            DrawRectangleRec(scoreBackground, Fade(LIGHTGRAY, 0.3f));
-            DrawTextEx(font, scoreText, (Vector2){ scoreBackground.x + padding, scoreBackground.y + padding }, 20, 1, WHITE);
-
-            // PB Score (top-right)
-            if (pbScore > 0)
-            {
-                char pbScoreText[1000];
-                sprintf(pbScoreText, "PB: %d", pbScore);
-                Vector2 pbScoreTextSize = MeasureTextEx(font, pbScoreText, 20, 1);
-
-                Rectangle pbScoreBackground = {
-                    SCREEN_WIDTH - 110, 10,
-                    100, 40
-                };
-                DrawRectangleRec(pbScoreBackground, Fade(GOLD, 0.5f));
-                DrawTextEx(font, pbScoreText,
-                        (Vector2){
-                        pbScoreBackground.x + (pbScoreBackground.width  - pbScoreTextSize.x) / 2,
-                        pbScoreBackground.y + (pbScoreBackground.height - pbScoreTextSize.y) / 2
-                        },
-                        20, 1, BLACK);
-            }
-
-            // Red flash overlay on every wrong key press
-            if (wrongKeyFlash > 0.0f)
-                DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, Fade(RED, wrongKeyFlash * 0.25f));
-
             // BUFFER OVERFLOW message after 3 consecutive wrong presses
-            if (bufferOverflow > 0.0f)
+            if (gs->bufferOverflow > 0.0f)
             {
                 const char *tiltText = "!! BUFFER OVERFLOW !!";
                 Vector2 tiltSize = MeasureTextEx(font, tiltText, 24, 1);
@@ -1028,10 +1542,23 @@ int main()
             }
 
             // GAME OVER SCREEN
-            if (gameOver)
+            if (gs->gameOver)
             {
+                char scoreText[32];
+                sprintf(scoreText, "Score: %d", gs->score);
+
+                // Versus: the race result replaces the restart hint
+                const char *restartText = "Press R to Restart";
+                if (versus)
+                {
+                    if (!rivalState.gameOver && !NetSessionPeerLost()) restartText = "Rival still flying...";
+                    else if (gs->score > rivalState.score)             restartText = "YOU WIN";
+                    else if (gs->score < rivalState.score)             restartText = "YOU LOSE";
+                    else                                               restartText = "DRAW";
+                }
+
                 Vector2 gameOverTextSize     = MeasureTextEx(font, "GAME OVER", 40, 1);
-                Vector2 restartTextSize      = MeasureTextEx(font, "Press R to Restart", 20, 1);
+                Vector2 restartTextSize      = MeasureTextEx(font, restartText, 20, 1);
                 Vector2 scoreGameOverTextSize= MeasureTextEx(font, scoreText, 30, 1);
 
                 float boxWidth  = fmaxf(fmaxf(gameOverTextSize.x, scoreGameOverTextSize.x), restartTextSize.x) + 40;
@@ -1050,7 +1577,7 @@ int main()
 
                 DrawTextEx(font, "GAME OVER", gameOverPos, 40, 1, RED);
                 DrawTextEx(font, scoreText, scoreGameOverPos, 30, 1, YELLOW);
-                DrawTextEx(font, "Press R to Restart", restartPos, 20, 1, GRAY);
+                DrawTextEx(font, restartText, restartPos, 20, 1, GRAY);
 
                 // "Press Q to Exit"
                 Vector2 exitTextSize = MeasureTextEx(font, "Press Q to Exit", 20, 1);
@@ -1061,18 +1588,18 @@ int main()
                 DrawTextEx(font, "Press Q to Exit", exitTextPos, 20, 1, GRAY);
 
                 // Restart
-                if (IsKeyPressed(KEY_R))
+                if (IsKeyPressed(KEY_R) && !versus)
                 {
-                    ResetGameState(walls, &playerPosition, &score, &wallSpeed, &gameOver, &gameOverTriggered, &invincibleCount);
+                    ResetGameState();
                     paused = false;
                 }
 
-                // Return to main menu
+                // Return to main menu (ends the race)
                 if (IsKeyPressed(KEY_Q))
                 {
-                    ResetGameState(walls, &playerPosition, &score, &wallSpeed, &gameOver, &gameOverTriggered, &invincibleCount);
+                    NetSessionClose();
+                    ResetGameState();
                     inMainMenu = true;
-                    gameOver   = false;
                 }
             }
         }
@@ -1125,22 +1652,43 @@ int main()
 
             // Handle input
             if (IsKeyPressed(KEY_R)) {
-                ResetGameState(walls, &playerPosition, &score, &wallSpeed, &gameOver, &gameOverTriggered, &invincibleCount);
+                RecordSession(gs, CAUSE_ABANDONED);
+                ResetGameState();
                 paused = false;
             }
 
             if (IsKeyPressed(KEY_Q)) {
-                ResetGameState(walls, &playerPosition, &score, &wallSpeed, &gameOver, &gameOverTriggered, &invincibleCount);
+                RecordSession(gs, CAUSE_ABANDONED);
+                ResetGameState();
                 inMainMenu = true;
                 paused = false;
             }
         }
 
+        if (showMemStats) MemStatsDraw(font);
+        TRACE_END(draw);
+
+        TRACE_BEGIN(present, "present");
         EndDrawing();
+        TRACE_END(present);
     }
 
     // Cleanup
+    MemStatsReport();
+    const GameState *gs = SimRunnerAcquireSnapshot();
+    if (!inMainMenu && !gs->gameOver) RecordSession(gs, CAUSE_ABANDONED);
+    NetSessionClose();
+    SimRunnerStop();
+    PatternLibraryClose();
+    TelemetryClose();
+    LeaderboardClose();
+    TRACE_FLUSH(SaveStoreGetDir());
+    SaveStoreClose();
+    UnloadRenderTexture(hud.target);
+    UnloadPostFx();
     UnloadFont(font);
+    GlyphCacheClose();
+    FinishSoundLoads();
     UnloadSound(crashSound);
     UnloadSound(blackHoleSound);
     UnloadSound(blockDestroy);
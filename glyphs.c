@@ -0,0 +1,319 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - dynamic glyph cache
+*******************************************************************************************/
+
+#include "glyphs.h"
+#include "memstats.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define GLYPH_COLUMNS     (GLYPH_ATLAS_SIZE / GLYPH_CELL_SIZE)
+#define GLYPH_SLOTS       (GLYPH_COLUMNS * GLYPH_COLUMNS)
+#define GLYPH_TABLE_BITS  9                               // twice the slots, so probes stay short
+#define GLYPH_TABLE_SIZE  (1 << GLYPH_TABLE_BITS)
+#define GLYPH_TABLE_MASK  (GLYPH_TABLE_SIZE - 1)
+#define GLYPH_FONTS       2                               // vcr.ttf, then the fallback
+
+/*******************************************************************************************
+*  DATA STRUCTURES
+*******************************************************************************************/
+
+typedef struct {
+    int      codepoint;    // -1 while the cell is free
+    int16_t  prev, next;   // LRU list, most recently drawn first
+    bool     ready;        // rasterized and uploaded
+    bool     queued;       // waiting in the upload queue
+    int      offsetX, offsetY, advanceX, width, height;
+    uint32_t lastFrame;    // cells drawn this frame are never evicted
+} GlyphSlot;
+
+typedef struct {
+    unsigned char *data;
+    int            size;
+} GlyphFont;
+
+/*******************************************************************************************
+*  GLOBAL VARIABLES
+*******************************************************************************************/
+
+static GlyphFont fonts[GLYPH_FONTS];
+static Texture2D atlas;
+static bool      cacheOpen = false;
+
+static GlyphSlot slots[GLYPH_SLOTS];
+static int16_t   table[GLYPH_TABLE_SIZE];     // codepoint -> slot, open addressing, -1 empty
+static int16_t   lruHead = -1, lruTail = -1;
+static uint32_t  frame   = 1;
+
+static int16_t   queue[GLYPH_SLOTS];          // slots to rasterize, in the order they were missed
+static int       queueHead = 0, queueCount = 0;
+
+static int       hits = 0, misses = 0, evictions = 0;
+
+/*******************************************************************************************
+*  FUNCTION DEFINITIONS
+*******************************************************************************************/
+
+static int TableHome(int codepoint)
+{
+    return (int)(((uint32_t)codepoint * 2654435761u) >> (32 - GLYPH_TABLE_BITS));
+}
+
+// Position holding codepoint, or the empty position where it would go
+static int TableFind(int codepoint)
+{
+    int i = TableHome(codepoint);
+    while (table[i] >= 0 && slots[table[i]].codepoint != codepoint) i = (i + 1) & GLYPH_TABLE_MASK;
+    return i;
+}
+
+// Backward-shift delete: entries after the hole move up unless they already sit at or past home
+static void TableRemove(int codepoint)
+{
+    int i = TableFind(codepoint);
+    if (table[i] < 0) return;
+
+    table[i] = -1;
+    for (int j = (i + 1) & GLYPH_TABLE_MASK; table[j] >= 0; j = (j + 1) & GLYPH_TABLE_MASK)
+    {
+        int home = TableHome(slots[table[j]].codepoint);
+        if (((j - home) & GLYPH_TABLE_MASK) >= ((j - i) & GLYPH_TABLE_MASK))
+        {
+            table[i] = table[j];
+            table[j] = -1;
+            i = j;
+        }
+    }
+}
+
+static void LruUnlink(int slot)
+{
+    GlyphSlot *s = &slots[slot];
+    if (s->prev >= 0) slots[s->prev].next = s->next; else lruHead = s->next;
+    if (s->next >= 0) slots[s->next].prev = s->prev; else lruTail = s->prev;
+}
+
+static void LruPushFront(int slot)
+{
+    slots[slot].prev = -1;
+    slots[slot].next = lruHead;
+    if (lruHead >= 0) slots[lruHead].prev = slot; else lruTail = slot;
+    lruHead = slot;
+}
+
+// Slot holding codepoint, claiming (and queueing) the least recently drawn one on a miss;
+// -1 when every cell is already in use this frame
+static int TouchGlyph(int codepoint)
+{
+    int position = TableFind(codepoint);
+    int slot     = table[position];
+
+    if (slot >= 0)
+    {
+        hits++;
+    }
+    else
+    {
+        slot = lruTail;
+        if (slots[slot].lastFrame == frame) return -1;
+
+        misses++;
+        if (slots[slot].codepoint >= 0)
+        {
+            evictions++;
+            TableRemove(slots[slot].codepoint);
+            position = TableFind(codepoint);
+        }
+
+        slots[slot].codepoint = codepoint;
+        slots[slot].ready     = false;
+        table[position]       = slot;
+
+        if (!slots[slot].queued)
+        {
+            slots[slot].queued = true;
+            queue[(queueHead + queueCount++) % GLYPH_SLOTS] = slot;
+        }
+    }
+
+    slots[slot].lastFrame = frame;
+    if (slot != lruHead)
+    {
+        LruUnlink(slot);
+        LruPushFront(slot);
+    }
+    return slot;
+}
+
+// Rasterizes a queued glyph from the first font that has it and writes its cell
+static void UploadGlyph(int slot)
+{
+    static unsigned char pixels[GLYPH_CELL_SIZE * GLYPH_CELL_SIZE * 4];
+    GlyphSlot *s = &slots[slot];
+    int codepoint = s->codepoint;
+
+    memset(pixels, 0, sizeof(pixels));
+    s->offsetX = s->offsetY = s->width = s->height = 0;
+    s->advanceX = GLYPH_BAKE_SIZE / 2;   // missing everywhere: an empty half-width cell
+
+    for (int i = 0; i < GLYPH_FONTS; i++)
+    {
+        if (!fonts[i].data) continue;
+
+        GlyphInfo *glyph = LoadFontData(fonts[i].data, fonts[i].size, GLYPH_BAKE_SIZE, &codepoint, 1, FONT_DEFAULT);
+        if (!glyph) continue;
+
+        bool found = glyph->image.data || glyph->advanceX > 0;   // raylib leaves both empty for unknown codepoints
+        if (found)
+        {
+            const unsigned char *alpha = glyph->image.data;
+            int width  = (glyph->image.width  < GLYPH_CELL_SIZE) ? glyph->image.width  : GLYPH_CELL_SIZE;
+            int height = (glyph->image.height < GLYPH_CELL_SIZE) ? glyph->image.height : GLYPH_CELL_SIZE;
+
+            for (int y = 0; alpha && y < height; y++)
+            {
+                for (int x = 0; x < width; x++)
+                {
+                    unsigned char *pixel = &pixels[(y * GLYPH_CELL_SIZE + x) * 4];
+                    pixel[0] = pixel[1] = pixel[2] = 255;
+                    pixel[3] = alpha[y * glyph->image.width + x];
+                }
+            }
+
+            s->offsetX  = glyph->offsetX;
+            s->offsetY  = glyph->offsetY;
+            s->advanceX = glyph->advanceX;
+            s->width    = alpha ? width  : 0;
+            s->height   = alpha ? height : 0;
+        }
+        UnloadFontData(glyph, 1);
+        if (found) break;
+    }
+
+    Rectangle cell = { (slot % GLYPH_COLUMNS) * GLYPH_CELL_SIZE, (slot / GLYPH_COLUMNS) * GLYPH_CELL_SIZE, GLYPH_CELL_SIZE, GLYPH_CELL_SIZE };
+    UpdateTextureRec(atlas, cell, pixels);
+    s->ready = true;
+}
+
+static bool LoadGlyphFont(GlyphFont *font, const char *path)
+{
+    if (!path || !FileExists(path)) return false;
+    font->data = LoadFileData(path, &font->size);
+    return font->data != NULL;
+}
+
+bool GlyphCacheOpen(const char *fontPath)
+{
+    if (!LoadGlyphFont(&fonts[0], fontPath)) return false;
+    if (LoadGlyphFont(&fonts[1], getenv("DEADTYPE_GLYPH_FONT")))
+    {
+        TraceLog(LOG_INFO, "GLYPHS: Fallback font %s", getenv("DEADTYPE_GLYPH_FONT"));
+    }
+
+    Image blank = GenImageColor(GLYPH_ATLAS_SIZE, GLYPH_ATLAS_SIZE, BLANK);
+    atlas = LoadTextureFromImage(blank);
+    UnloadImage(blank);
+    SetTextureFilter(atlas, TEXTURE_FILTER_BILINEAR);
+
+    // Every cell starts free on the LRU list, so misses fill them before evicting anything
+    memset(table, -1, sizeof(table));
+    lruHead = lruTail = -1;
+    for (int i = 0; i < GLYPH_SLOTS; i++)
+    {
+        slots[i] = (GlyphSlot){ .codepoint = -1 };
+        LruPushFront(i);
+    }
+
+    MemStatsTrack(MEM_FONT, "glyph cache", fonts[0].size + fonts[1].size + sizeof(slots) + sizeof(table),
+                  (size_t)GLYPH_ATLAS_SIZE * GLYPH_ATLAS_SIZE * 4);
+    cacheOpen = true;
+    return true;
+}
+
+void GlyphCacheUpdate(void)
+{
+    if (!cacheOpen) return;
+
+    frame++;
+    for (int uploads = 0; queueCount > 0 && uploads < GLYPH_UPLOADS_PER_FRAME; uploads++)
+    {
+        int slot = queue[queueHead];
+        queueHead = (queueHead + 1) % GLYPH_SLOTS;
+        queueCount--;
+
+        slots[slot].queued = false;
+        UploadGlyph(slot);
+    }
+}
+
+void GlyphCacheDrawText(const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    if (!cacheOpen) return;
+
+    float scale = fontSize / GLYPH_BAKE_SIZE;
+    float x     = position.x;
+
+    for (int i = 0; text[i]; )
+    {
+        int size      = 0;
+        int codepoint = GetCodepointNext(&text[i], &size);
+        int slot      = TouchGlyph(codepoint);
+        i += size;
+
+        // Not rasterized yet: hold roughly its place so the line doesn't jump much
+        if (slot < 0 || !slots[slot].ready)
+        {
+            x += GLYPH_BAKE_SIZE / 2 * scale + spacing;
+            continue;
+        }
+
+        const GlyphSlot *s = &slots[slot];
+        if (s->width > 0)
+        {
+            Rectangle source = { (slot % GLYPH_COLUMNS) * GLYPH_CELL_SIZE, (slot / GLYPH_COLUMNS) * GLYPH_CELL_SIZE, s->width, s->height };
+            Rectangle dest   = { x + s->offsetX * scale, position.y + s->offsetY * scale, s->width * scale, s->height * scale };
+            DrawTexturePro(atlas, source, dest, (Vector2){ 0, 0 }, 0.0f, tint);
+        }
+        x += s->advanceX * scale + spacing;
+    }
+}
+
+Vector2 GlyphCacheMeasureText(const char *text, float fontSize, float spacing)
+{
+    float scale = fontSize / GLYPH_BAKE_SIZE;
+    float width = 0.0f;
+    int   count = 0;
+
+    for (int i = 0; cacheOpen && text[i]; count++)
+    {
+        int size      = 0;
+        int codepoint = GetCodepointNext(&text[i], &size);
+        int slot      = TouchGlyph(codepoint);
+        i += size;
+
+        width += ((slot >= 0 && slots[slot].ready) ? slots[slot].advanceX : GLYPH_BAKE_SIZE / 2) * scale;
+    }
+    if (count > 1) width += (count - 1) * spacing;
+
+    return (Vector2){ width, fontSize };
+}
+
+void GlyphCacheClose(void)
+{
+    if (!cacheOpen) return;
+
+    TraceLog(LOG_INFO, "GLYPHS: %d hits, %d misses, %d evictions", hits, misses, evictions);
+    UnloadTexture(atlas);
+    for (int i = 0; i < GLYPH_FONTS; i++)
+    {
+        if (fonts[i].data) UnloadFileData(fonts[i].data);
+        fonts[i] = (GlyphFont){ 0 };
+    }
+    queueHead = queueCount = 0;
+    cacheOpen = false;
+}
@@ -0,0 +1,40 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - dynamic glyph cache
+ *
+ * LoadFont bakes a fixed ASCII set up front. Text that may hold any codepoint (accented
+ * Latin, Cyrillic, kana, ...) goes through this cache instead: a glyph is rasterized from
+ * vcr.ttf the first time it is drawn (or from the fallback font in DEADTYPE_GLYPH_FONT when
+ * vcr.ttf lacks it) into one cell of a fixed atlas texture, and the least recently drawn
+ * glyph gives up its cell when the atlas is full.
+ *
+ * Misses are only queued while drawing; GlyphCacheUpdate rasterizes and uploads a few of
+ * them per frame, so a screen full of new glyphs fills in over several frames instead of
+ * stalling one. Until then a glyph takes up space but draws nothing.
+*******************************************************************************************/
+
+#ifndef GLYPHS_H
+#define GLYPHS_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define GLYPH_BAKE_SIZE         28      // rasterized size; drawing scales from it like a Font
+#define GLYPH_CELL_SIZE         32
+#define GLYPH_ATLAS_SIZE        512     // 16 x 16 cells, 1 MB of RGBA
+#define GLYPH_UPLOADS_PER_FRAME 8
+
+/*******************************************************************************************
+*  FUNCTION DECLARATIONS
+*******************************************************************************************/
+
+bool    GlyphCacheOpen(const char *fontPath);   // after InitWindow; false without the font
+void    GlyphCacheUpdate(void);                 // once per frame, before drawing
+void    GlyphCacheDrawText(const char *text, Vector2 position, float fontSize, float spacing, Color tint);   // UTF-8
+Vector2 GlyphCacheMeasureText(const char *text, float fontSize, float spacing);
+void    GlyphCacheClose(void);
+
+#endif // GLYPHS_H
@@ -0,0 +1,593 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - online leaderboard submission
+*******************************************************************************************/
+
+#include "raylib.h"
+#include "leaderboard.h"
+#include "save.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef PLATFORM_WEB
+    #include <emscripten/emscripten.h>
+#else
+    #include <pthread.h>
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <netdb.h>
+    #include <poll.h>
+    #include <unistd.h>
+    #include <sys/socket.h>
+#endif
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define LEADERBOARD_OUTBOX_MAX   64       // unsent runs kept; the oldest go first when full
+#define LEADERBOARD_BATCH_MAX    32       // runs per request
+#define LEADERBOARD_QUIET_TIME   3.0      // seconds without a new run before sending
+#define LEADERBOARD_BACKOFF_MIN  2.0      // first retry delay, doubled per failure
+#define LEADERBOARD_BACKOFF_MAX  300.0
+#define LEADERBOARD_POLL_TIME    0.25     // sender wake-up interval
+#define LEADERBOARD_TIMEOUT_MS   5000     // connect / send / receive
+#define LEADERBOARD_FILE_NAME    "outbox.txt"
+
+#if !defined(PLATFORM_WEB) && !defined(MSG_NOSIGNAL)
+    #define MSG_NOSIGNAL 0   // macOS has no per-call flag
+#endif
+
+/*******************************************************************************************
+*  GLOBAL VARIABLES
+*******************************************************************************************/
+
+static bool     enabled     = false;
+static uint8_t  secretKey[16];
+static char     outboxPath[512];
+
+// Pending lines, oldest first (guarded by outboxLock on native)
+static char     outbox[LEADERBOARD_OUTBOX_MAX][LEADERBOARD_LINE_MAX];
+static int      outboxCount = 0;
+static bool     outboxDirty = false;   // differs from the file
+static int      inFlight    = 0;       // front lines in the request being sent
+static double   lastSubmit  = 0;       // when the latest run was queued
+static double   nextAttempt = 0;       // no request before this (backoff)
+static double   backoff     = 0;
+static uint32_t jitterState = 0;
+static uint64_t runIdState  = 0;       // splitmix64, seeded from /dev/urandom
+
+#ifdef PLATFORM_WEB
+static char     serverUrl[512];
+static bool     outboxLoaded = false;  // waits for IDBFS to mount
+static bool     requestInFlight = false;
+#else
+static char            serverHost[256];
+static char            serverPort[16];
+static pthread_t       senderThread;
+static pthread_mutex_t outboxLock    = PTHREAD_MUTEX_INITIALIZER;
+static bool            senderRunning = false;
+#endif
+
+/*******************************************************************************************
+*  FUNCTION DEFINITIONS
+*******************************************************************************************/
+
+#define ROTL(x, b) (((x) << (b)) | ((x) >> (64 - (b))))
+#define SIPROUND                                                        \
+    do {                                                                \
+        v0 += v1; v1 = ROTL(v1, 13); v1 ^= v0; v0 = ROTL(v0, 32);       \
+        v2 += v3; v3 = ROTL(v3, 16); v3 ^= v2;                          \
+        v0 += v3; v3 = ROTL(v3, 21); v3 ^= v0;                          \
+        v2 += v1; v1 = ROTL(v1, 17); v1 ^= v2; v2 = ROTL(v2, 32);       \
+    } while (0)
+
+static uint64_t ReadLE64(const uint8_t *p)
+{
+    uint64_t v = 0;
+    for (int i = 7; i >= 0; i--) v = (v << 8) | p[i];
+    return v;
+}
+
+// SipHash-2-4 (Aumasson & Bernstein), 64-bit output
+uint64_t LeaderboardSipHash(const uint8_t key[16], const void *data, size_t size)
+{
+    const uint8_t *in = data;
+    uint64_t k0 = ReadLE64(key), k1 = ReadLE64(key + 8);
+    uint64_t v0 = k0 ^ 0x736F6D6570736575ULL;
+    uint64_t v1 = k1 ^ 0x646F72616E646F6DULL;
+    uint64_t v2 = k0 ^ 0x6C7967656E657261ULL;
+    uint64_t v3 = k1 ^ 0x7465646279746573ULL;
+
+    size_t blocks = size / 8;
+    for (size_t i = 0; i < blocks; i++, in += 8)
+    {
+        uint64_t m = ReadLE64(in);
+        v3 ^= m;
+        SIPROUND;
+        SIPROUND;
+        v0 ^= m;
+    }
+
+    // Last block: remaining bytes plus the length in the top byte
+    uint64_t last = (uint64_t)size << 56;
+    for (size_t i = 0; i < size % 8; i++) last |= (uint64_t)in[i] << (8 * i);
+
+    v3 ^= last;
+    SIPROUND;
+    SIPROUND;
+    v0 ^= last;
+
+    v2 ^= 0xFF;
+    SIPROUND;
+    SIPROUND;
+    SIPROUND;
+    SIPROUND;
+    return v0 ^ v1 ^ v2 ^ v3;
+}
+
+void LeaderboardKey(uint8_t key[16])
+{
+    const char *text = getenv("DEADTYPE_LEADERBOARD_KEY");
+    if (!text || !*text) text = LEADERBOARD_DEFAULT_KEY;
+
+    memset(key, 0, 16);
+    memcpy(key, text, strnlen(text, 16));
+}
+
+// The digest covers the exact text before it, so both ends agree without float round trips
+int LeaderboardFormatLine(char *out, size_t size, const LeaderboardEntry *entry, const uint8_t key[16])
+{
+    int length = snprintf(out, size, "%lld %016llx %u %d %.3f %d %016llx", (long long)entry->timestamp,
+                          (unsigned long long)entry->runId, entry->seed, entry->score, entry->duration,
+                          entry->cause, (unsigned long long)entry->replayHash);
+    if (length < 0 || (size_t)length >= size) return 0;
+
+    uint64_t digest = LeaderboardSipHash(key, out, length);
+    length += snprintf(out + length, size - length, " %016llx\n", (unsigned long long)digest);
+    return ((size_t)length < size) ? length : 0;
+}
+
+bool LeaderboardParseLine(const char *line, LeaderboardEntry *entry, const uint8_t key[16])
+{
+    long long          timestamp;
+    unsigned long long runId, replayHash, digest;
+
+    if (sscanf(line, "%lld %llx %u %d %f %d %llx %llx", &timestamp, &runId, &entry->seed, &entry->score,
+               &entry->duration, &entry->cause, &replayHash, &digest) != 8) return false;
+
+    entry->timestamp  = timestamp;
+    entry->runId      = runId;
+    entry->replayHash = replayHash;
+
+    const char *digestText = strrchr(line, ' ');
+    return LeaderboardSipHash(key, line, digestText - line) == digest;
+}
+
+/*******************************************************************************************
+*  OUTBOX
+*******************************************************************************************/
+
+#ifdef PLATFORM_WEB
+    #define LOCK_OUTBOX()
+    #define UNLOCK_OUTBOX()
+#else
+    #define LOCK_OUTBOX()    pthread_mutex_lock(&outboxLock)
+    #define UNLOCK_OUTBOX()  pthread_mutex_unlock(&outboxLock)
+#endif
+
+static double NowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Run ids only need to differ between runs with the same seed, but those can come from
+// installs started in the same second, so the clock alone isn't enough
+static void SeedRunIds(void)
+{
+    FILE *random = fopen("/dev/urandom", "rb");     // Emscripten backs it with crypto.getRandomValues
+    if (!random || fread(&runIdState, sizeof(runIdState), 1, random) != 1)
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        runIdState = ((uint64_t)ts.tv_sec << 32) ^ (uint64_t)ts.tv_nsec ^ (uint64_t)(uintptr_t)&ts;
+    }
+    if (random) fclose(random);
+}
+
+static uint64_t NextRunId(void)
+{
+    uint64_t z = (runIdState += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static void QueueLine(const char *line)
+{
+    if (outboxCount == LEADERBOARD_OUTBOX_MAX)
+    {
+        TraceLog(LOG_WARNING, "LEADERBOARD: Outbox full, oldest run dropped");
+        memmove(outbox[0], outbox[1], sizeof(outbox[0]) * (LEADERBOARD_OUTBOX_MAX - 1));
+        outboxCount--;
+        if (inFlight > 0) inFlight--;   // that run was in the request, don't drop another for it
+    }
+
+    snprintf(outbox[outboxCount++], LEADERBOARD_LINE_MAX, "%s", line);
+    outboxDirty = true;
+}
+
+// Reads unsent runs from a previous session in front of anything queued since
+static void LoadOutbox(void)
+{
+    FILE *file = fopen(outboxPath, "r");
+    if (!file) return;
+
+    char pending[LEADERBOARD_OUTBOX_MAX][LEADERBOARD_LINE_MAX];
+    int  pendingCount = outboxCount;
+    memcpy(pending, outbox, sizeof(outbox[0]) * outboxCount);
+    outboxCount = 0;
+
+    char line[LEADERBOARD_LINE_MAX];
+    while (fgets(line, sizeof(line), file))
+    {
+        if (strchr(line, '\n')) QueueLine(line);   // a torn last line is dropped
+    }
+    fclose(file);
+
+    if (outboxCount) TraceLog(LOG_INFO, "LEADERBOARD: %d unsent runs from last time", outboxCount);
+    for (int i = 0; i < pendingCount; i++) QueueLine(pending[i]);
+    outboxDirty = pendingCount > 0;
+}
+
+// Replaces the outbox file in one rename, so a crash leaves the old or the new one
+static void WriteOutbox(char lines[][LEADERBOARD_LINE_MAX], int count)
+{
+    char tempPath[520];
+    snprintf(tempPath, sizeof(tempPath), "%s.tmp", outboxPath);
+
+    FILE *file = fopen(tempPath, "w");
+    if (!file)
+    {
+        TraceLog(LOG_WARNING, "LEADERBOARD: Can't write %s", tempPath);
+        return;
+    }
+    for (int i = 0; i < count; i++) fputs(lines[i], file);
+    fclose(file);
+    rename(tempPath, outboxPath);
+}
+
+// Concatenates the oldest runs into a request body and marks them in flight
+static void BuildBatch(char *body, size_t size)
+{
+    int    lines  = 0;
+    size_t length = 0;
+    body[0] = '\0';
+
+    while (lines < outboxCount && lines < LEADERBOARD_BATCH_MAX)
+    {
+        size_t lineLength = strlen(outbox[lines]);
+        if (length + lineLength >= size) break;
+        memcpy(body + length, outbox[lines], lineLength + 1);
+        length += lineLength;
+        lines++;
+    }
+    inFlight = lines;
+}
+
+// Outcome of sending the runs in flight; status 0 means no response at all, which may
+// still have been stored, so a retry relies on the server dropping repeated run ids
+static void HandleResponse(int status)
+{
+    int lines = inFlight;
+    inFlight = 0;
+
+    bool delivered = (status >= 200 && status < 300);
+    bool refused   = (status >= 400 && status < 500 && status != 408 && status != 429);
+
+    if (delivered || refused)
+    {
+        // Retrying a request the server refused won't change its mind
+        if (refused) TraceLog(LOG_WARNING, "LEADERBOARD: Server refused %d runs (HTTP %d)", lines, status);
+        else         TraceLog(LOG_INFO, "LEADERBOARD: Submitted %d runs", lines);
+
+        memmove(outbox[0], outbox[lines], sizeof(outbox[0]) * (outboxCount - lines));
+        outboxCount -= lines;
+        outboxDirty  = true;
+        backoff      = 0;
+        nextAttempt  = 0;
+        return;
+    }
+
+    // Exponential backoff with +-25% jitter so clients don't retry in lockstep
+    backoff = (backoff == 0) ? LEADERBOARD_BACKOFF_MIN : backoff * 2;
+    if (backoff > LEADERBOARD_BACKOFF_MAX) backoff = LEADERBOARD_BACKOFF_MAX;
+
+    jitterState ^= jitterState << 13;
+    jitterState ^= jitterState >> 17;
+    jitterState ^= jitterState << 5;
+    nextAttempt = NowSeconds() + backoff * (0.75 + 0.5 * (jitterState % 1000) / 1000.0);
+
+    if (status) TraceLog(LOG_WARNING, "LEADERBOARD: Submit failed (HTTP %d), retrying in %.0fs", status, backoff);
+    else        TraceLog(LOG_WARNING, "LEADERBOARD: Server unreachable, retrying in %.0fs", backoff);
+}
+
+static bool SendDue(double now)
+{
+    double quietUntil = lastSubmit + LEADERBOARD_QUIET_TIME;
+    return outboxCount > 0 && now >= quietUntil && now >= nextAttempt;
+}
+
+#ifndef PLATFORM_WEB
+
+/*******************************************************************************************
+*  NATIVE SENDER
+*******************************************************************************************/
+
+// "host:port" or "http://host:port[/...]"
+static bool ParseServer(const char *address)
+{
+    if (!strncmp(address, "http://", 7)) address += 7;
+
+    const char *colon = strchr(address, ':');
+    if (!colon || colon == address || (size_t)(colon - address) >= sizeof(serverHost)) return false;
+
+    snprintf(serverHost, sizeof(serverHost), "%.*s", (int)(colon - address), address);
+    snprintf(serverPort, sizeof(serverPort), "%.*s", (int)strcspn(colon + 1, "/"), colon + 1);
+    return serverPort[0] != '\0';
+}
+
+// Connect with a deadline instead of the OS default (minutes for an unreachable host)
+static int ConnectWithTimeout(void)
+{
+    struct addrinfo hints = { .ai_family = AF_UNSPEC, .ai_socktype = SOCK_STREAM };
+    struct addrinfo *addresses = NULL;
+    if (getaddrinfo(serverHost, serverPort, &hints, &addresses) != 0) return -1;
+
+    int sock = socket(addresses->ai_family, addresses->ai_socktype, addresses->ai_protocol);
+    if (sock >= 0)
+    {
+        int flags = fcntl(sock, F_GETFL, 0);
+        fcntl(sock, F_SETFL, flags | O_NONBLOCK);
+
+        int result = connect(sock, addresses->ai_addr, addresses->ai_addrlen);
+        if (result != 0 && errno == EINPROGRESS)
+        {
+            struct pollfd pfd = { .fd = sock, .events = POLLOUT };
+            int error = 0;
+            socklen_t length = sizeof(error);
+            if (poll(&pfd, 1, LEADERBOARD_TIMEOUT_MS) == 1 &&
+                getsockopt(sock, SOL_SOCKET, SO_ERROR, &error, &length) == 0 && error == 0) result = 0;
+        }
+
+        if (result == 0)
+        {
+            fcntl(sock, F_SETFL, flags);
+            struct timeval timeout = { LEADERBOARD_TIMEOUT_MS / 1000, 0 };
+            setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+            setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        }
+        else
+        {
+            close(sock);
+            sock = -1;
+        }
+    }
+
+    freeaddrinfo(addresses);
+    return sock;
+}
+
+// Minimal HTTP/1.0 POST, returns the status code (0 if the exchange failed)
+static int HttpPost(const char *body)
+{
+    int sock = ConnectWithTimeout();
+    if (sock < 0) return 0;
+
+    char header[512];
+    size_t bodyLength = strlen(body);
+    int headerLength = snprintf(header, sizeof(header),
+            "POST %s HTTP/1.0\r\nHost: %s:%s\r\nContent-Type: text/plain\r\nContent-Length: %zu\r\n\r\n",
+            LEADERBOARD_PATH, serverHost, serverPort, bodyLength);
+
+    int status = 0;
+    if (send(sock, header, headerLength, MSG_NOSIGNAL) == headerLength &&
+        send(sock, body, bodyLength, MSG_NOSIGNAL) == (ssize_t)bodyLength)
+    {
+        char reply[64] = { 0 };
+        ssize_t received = recv(sock, reply, sizeof(reply) - 1, 0);
+        if (received <= 0 || sscanf(reply, "HTTP/%*d.%*d %d", &status) != 1) status = 0;
+    }
+
+    close(sock);
+    return status;
+}
+
+// Sender thread: persists the outbox and sends batches, never holding the lock across I/O
+static void *SenderMain(void *arg)
+{
+    (void)arg;
+    static char snapshot[LEADERBOARD_OUTBOX_MAX][LEADERBOARD_LINE_MAX];
+    static char body[LEADERBOARD_BATCH_MAX * LEADERBOARD_LINE_MAX];
+
+    LOCK_OUTBOX();
+    for (;;)
+    {
+        if (outboxDirty)
+        {
+            int count = outboxCount;
+            memcpy(snapshot, outbox, sizeof(outbox[0]) * count);
+            outboxDirty = false;
+
+            UNLOCK_OUTBOX();
+            WriteOutbox(snapshot, count);
+            LOCK_OUTBOX();
+            continue;
+        }
+
+        if (!senderRunning) break;
+
+        if (!SendDue(NowSeconds()))
+        {
+            UNLOCK_OUTBOX();
+            struct timespec ts = { 0, (long)(LEADERBOARD_POLL_TIME * 1e9) };
+            nanosleep(&ts, NULL);
+            LOCK_OUTBOX();
+            continue;
+        }
+
+        BuildBatch(body, sizeof(body));
+        UNLOCK_OUTBOX();
+        int status = HttpPost(body);
+        LOCK_OUTBOX();
+
+        // Runs queued meanwhile went behind the batch; any that evicted part of it already
+        // took those lines off inFlight, so the front inFlight lines are what's left of it
+        HandleResponse(status);
+    }
+    UNLOCK_OUTBOX();
+    return NULL;
+}
+
+bool LeaderboardOpen(const char *dir)
+{
+    const char *address = getenv("DEADTYPE_LEADERBOARD");
+    if (!address || !*address) return false;
+    if (!ParseServer(address))
+    {
+        TraceLog(LOG_WARNING, "LEADERBOARD: Expected host:port, got \"%s\"", address);
+        return false;
+    }
+
+    LeaderboardKey(secretKey);
+    snprintf(outboxPath, sizeof(outboxPath), "%s/%s", dir, LEADERBOARD_FILE_NAME);
+    jitterState = (uint32_t)time(NULL) | 1;
+    SeedRunIds();
+    LoadOutbox();
+
+    senderRunning = true;
+    if (pthread_create(&senderThread, NULL, SenderMain, NULL) != 0)
+    {
+        senderRunning = false;
+        TraceLog(LOG_WARNING, "LEADERBOARD: Sender thread failed to start");
+        return false;
+    }
+
+    enabled = true;
+    TraceLog(LOG_INFO, "LEADERBOARD: Submitting to %s:%s", serverHost, serverPort);
+    return true;
+}
+
+void LeaderboardPump(void)
+{
+}
+
+// Waits at most for the request in flight (bounded by the socket timeouts)
+void LeaderboardClose(void)
+{
+    if (!enabled) return;
+
+    LOCK_OUTBOX();
+    senderRunning = false;
+    UNLOCK_OUTBOX();
+    pthread_join(senderThread, NULL);
+    enabled = false;
+}
+
+#else
+
+/*******************************************************************************************
+*  WEB SENDER
+*******************************************************************************************/
+
+EMSCRIPTEN_KEEPALIVE void LeaderboardOnResponse(int status)
+{
+    HandleResponse(status);
+    requestInFlight = false;
+}
+
+bool LeaderboardOpen(const char *dir)
+{
+    const char *url = emscripten_run_script_string(
+            "new URLSearchParams(window.location.search).get('leaderboard') || ''");
+    if (!url || !*url) return false;
+
+    snprintf(serverUrl, sizeof(serverUrl), "%s%s", url, LEADERBOARD_PATH);
+    snprintf(outboxPath, sizeof(outboxPath), "%s/%s", dir, LEADERBOARD_FILE_NAME);
+    LeaderboardKey(secretKey);
+    jitterState = (uint32_t)time(NULL) | 1;
+    SeedRunIds();
+
+    enabled = true;
+    TraceLog(LOG_INFO, "LEADERBOARD: Submitting to %s", serverUrl);
+    return true;
+}
+
+void LeaderboardPump(void)
+{
+    static char body[LEADERBOARD_BATCH_MAX * LEADERBOARD_LINE_MAX];
+
+    if (!enabled) return;
+
+    // The outbox lives in IDBFS, which mounts a few frames after start
+    if (!outboxLoaded)
+    {
+        if (!SaveStoreReady()) return;
+        LoadOutbox();
+        outboxLoaded = true;
+    }
+
+    if (outboxDirty)
+    {
+        WriteOutbox(outbox, outboxCount);
+        SaveStoreRequestSync();
+        outboxDirty = false;
+    }
+
+    if (requestInFlight || !SendDue(NowSeconds())) return;
+
+    BuildBatch(body, sizeof(body));
+    requestInFlight = true;
+    EM_ASM({
+        fetch(UTF8ToString($0), { method: 'POST', headers: { 'Content-Type': 'text/plain' }, body: UTF8ToString($1) })
+            .then(function (response) { ccall('LeaderboardOnResponse', null, ['number'], [response.status]); })
+            .catch(function () { ccall('LeaderboardOnResponse', null, ['number'], [0]); });
+    }, serverUrl, body);
+}
+
+// Anything unsent is already in the outbox; an in-flight fetch may be sent again next time,
+// which the server ignores by run id
+void LeaderboardClose(void)
+{
+    LeaderboardPump();
+    enabled = false;
+}
+
+#endif
+
+// Called on the game-over path; quick restarts just queue more lines into the same quiet window
+void LeaderboardSubmit(const GameState *gs)
+{
+    if (!enabled) return;
+
+    LeaderboardEntry entry = {
+        .timestamp  = (int64_t)time(NULL),
+        .runId      = NextRunId(),
+        .seed       = gs->seed,
+        .score      = gs->score,
+        .duration   = gs->playTime,
+        .cause      = gs->deathCause,
+        .replayHash = gs->replayHash,
+    };
+
+    char line[LEADERBOARD_LINE_MAX];
+    if (!LeaderboardFormatLine(line, sizeof(line), &entry, secretKey)) return;
+
+    LOCK_OUTBOX();
+    QueueLine(line);
+    lastSubmit = NowSeconds();
+    UNLOCK_OUTBOX();
+}
@@ -0,0 +1,68 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - online leaderboard submission
+ *
+ * Finished runs go into a persistent outbox (outbox.txt next to the session log) and are
+ * sent as one batched HTTP POST once submissions have been quiet for a moment, so a burst
+ * of quick restarts ends up in a single request. Failed sends back off exponentially and
+ * survive restarts of the game. On native a sender thread does all file and socket work;
+ * on web LeaderboardPump starts a fetch() and the browser does the waiting.
+ *
+ * Each line carries a SipHash-2-4 digest of the run's fields including its replay hash
+ * (GameState.replayHash). The key ships in every client, so the digest is an integrity
+ * check only: it catches lines damaged in the outbox or in transit, not forged scores.
+ * Anything that must be trusted has to be checked on the server, e.g. by replaying the run.
+ *
+ * Every run gets a random run id when it's queued. A timeout can hit after the server
+ * already stored a batch, so the client resends it; the server keys on run id and seed
+ * and acknowledges a repeat without storing it again.
+ *
+ * Opt-in: native reads DEADTYPE_LEADERBOARD=host:port, web the ?leaderboard=<url> query
+ * parameter. tools/leaderboard_server is a local stand-in server.
+*******************************************************************************************/
+
+#ifndef LEADERBOARD_H
+#define LEADERBOARD_H
+
+#include "sim.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define LEADERBOARD_PATH         "/scores"
+#define LEADERBOARD_LINE_MAX     128               // one submission in the wire format
+#define LEADERBOARD_DEFAULT_KEY  "0xDEAD//TYPE dev" // 16 bytes, public; override with DEADTYPE_LEADERBOARD_KEY
+
+/*******************************************************************************************
+*  DATA STRUCTURES
+*******************************************************************************************/
+
+// One submission. On the wire and in the outbox it is a line of text:
+// "<timestamp> <runId> <seed> <score> <duration> <cause> <replayHash> <digest>\n"
+typedef struct {
+    int64_t  timestamp;     // unix seconds
+    uint64_t runId;         // random per run; with the seed, the server's duplicate key
+    uint32_t seed;
+    int32_t  score;
+    float    duration;      // seconds alive
+    int32_t  cause;         // DeathCause
+    uint64_t replayHash;
+} LeaderboardEntry;
+
+/*******************************************************************************************
+*  FUNCTION DECLARATIONS
+*******************************************************************************************/
+
+bool     LeaderboardOpen(const char *dir);          // false unless a server is configured
+void     LeaderboardSubmit(const GameState *gs);    // Queue a finished run, never blocks
+void     LeaderboardPump(void);                     // Call once per frame (web: starts requests)
+void     LeaderboardClose(void);                    // Stops the sender, the outbox keeps what's unsent
+
+// Shared with the stand-in server
+void     LeaderboardKey(uint8_t key[16]);           // DEADTYPE_LEADERBOARD_KEY or the default
+uint64_t LeaderboardSipHash(const uint8_t key[16], const void *data, size_t size);
+int      LeaderboardFormatLine(char *out, size_t size, const LeaderboardEntry *entry, const uint8_t key[16]);
+bool     LeaderboardParseLine(const char *line, LeaderboardEntry *entry, const uint8_t key[16]); // false if malformed or damaged
+
+#endif // LEADERBOARD_H
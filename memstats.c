@@ -0,0 +1,217 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - memory accounting
+*******************************************************************************************/
+
+#include "memstats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(PLATFORM_WEB)
+    #include <emscripten/heap.h>
+#elif defined(__linux__)
+    #include <unistd.h>
+#endif
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define MEM_MAX_ENTRIES   64
+#define MEM_NAME_LENGTH   32
+#define MB                (1024.0 * 1024.0)
+
+/*******************************************************************************************
+*  DATA STRUCTURES
+*******************************************************************************************/
+
+typedef struct {
+    char        name[MEM_NAME_LENGTH];
+    MemCategory category;
+    size_t      cpuBytes;
+    size_t      gpuBytes;
+} MemEntry;
+
+/*******************************************************************************************
+*  GLOBAL VARIABLES
+*******************************************************************************************/
+
+static MemEntry entries[MEM_MAX_ENTRIES];
+static int      entryCount = 0;
+static size_t   cpuBudget  = (size_t)(MEM_DEFAULT_CPU_BUDGET_MB * MB);
+static size_t   gpuBudget  = (size_t)(MEM_DEFAULT_GPU_BUDGET_MB * MB);
+static bool     cpuWarned  = false;
+static bool     gpuWarned  = false;
+
+static const char *categoryNames[MEM_CATEGORY_COUNT] = { "audio", "fonts", "textures", "simulation" };
+
+/*******************************************************************************************
+*  FUNCTION DEFINITIONS
+*******************************************************************************************/
+
+static size_t BudgetFromEnv(const char *variable, size_t fallback)
+{
+    const char *value = getenv(variable);
+    if (!value || atof(value) <= 0.0) return fallback;
+    return (size_t)(atof(value) * MB);
+}
+
+static void Totals(size_t *cpu, size_t *gpu)
+{
+    *cpu = *gpu = 0;
+    for (int i = 0; i < entryCount; i++)
+    {
+        *cpu += entries[i].cpuBytes;
+        *gpu += entries[i].gpuBytes;
+    }
+}
+
+// Whole-process resident memory where the platform tells us (0 if unknown)
+static size_t ProcessResident(void)
+{
+#if defined(PLATFORM_WEB)
+    return emscripten_get_heap_size();
+#elif defined(__linux__)
+    long pages = 0;
+    FILE *statm = fopen("/proc/self/statm", "r");
+    if (statm)
+    {
+        if (fscanf(statm, "%*d %ld", &pages) != 1) pages = 0;
+        fclose(statm);
+    }
+    return (size_t)pages * sysconf(_SC_PAGESIZE);
+#else
+    return 0;
+#endif
+}
+
+void MemStatsInit(void)
+{
+    cpuBudget = BudgetFromEnv("DEADTYPE_CPU_BUDGET_MB", cpuBudget);
+    gpuBudget = BudgetFromEnv("DEADTYPE_GPU_BUDGET_MB", gpuBudget);
+}
+
+void MemStatsTrack(MemCategory category, const char *name, size_t cpuBytes, size_t gpuBytes)
+{
+    MemEntry *entry = NULL;
+    for (int i = 0; i < entryCount && !entry; i++)
+    {
+        if (!strncmp(entries[i].name, name, MEM_NAME_LENGTH - 1)) entry = &entries[i];
+    }
+
+    if (!entry)
+    {
+        if (entryCount == MEM_MAX_ENTRIES)
+        {
+            TraceLog(LOG_WARNING, "MEM: Too many tracked entries, %s not counted", name);
+            return;
+        }
+        entry = &entries[entryCount++];
+        snprintf(entry->name, sizeof(entry->name), "%s", name);
+    }
+
+    entry->category = category;
+    entry->cpuBytes = cpuBytes;
+    entry->gpuBytes = gpuBytes;
+
+    size_t cpu, gpu;
+    Totals(&cpu, &gpu);
+    if (cpu > cpuBudget && !cpuWarned)
+    {
+        TraceLog(LOG_WARNING, "MEM: CPU budget exceeded (%.1f / %.1f MB) after loading %s", cpu / MB, cpuBudget / MB, name);
+        cpuWarned = true;
+    }
+    if (gpu > gpuBudget && !gpuWarned)
+    {
+        TraceLog(LOG_WARNING, "MEM: GPU budget exceeded (%.1f / %.1f MB) after loading %s", gpu / MB, gpuBudget / MB, name);
+        gpuWarned = true;
+    }
+}
+
+// Sounds are converted to the device format on load and kept whole in memory
+void MemStatsTrackSound(const char *name, Sound sound)
+{
+    size_t bytes = (size_t)sound.frameCount * sound.stream.channels * (sound.stream.sampleSize / 8);
+    MemStatsTrack(MEM_AUDIO, name, bytes, 0);
+}
+
+// Fonts keep every glyph image on the CPU next to the atlas texture
+void MemStatsTrackFont(const char *name, Font font)
+{
+    size_t cpu = font.glyphCount * (sizeof(GlyphInfo) + sizeof(Rectangle));
+    for (int i = 0; i < font.glyphCount && font.glyphs; i++)
+    {
+        Image image = font.glyphs[i].image;
+        if (image.data) cpu += GetPixelDataSize(image.width, image.height, image.format);
+    }
+
+    MemStatsTrack(MEM_FONT, name, cpu, GetPixelDataSize(font.texture.width, font.texture.height, font.texture.format));
+}
+
+void MemStatsTrackTexture(const char *name, Texture2D texture)
+{
+    MemStatsTrack(MEM_TEXTURE, name, 0, GetPixelDataSize(texture.width, texture.height, texture.format));
+}
+
+// Color attachment plus a 24-bit depth renderbuffer (padded to 4 bytes per pixel)
+void MemStatsTrackRenderTexture(const char *name, RenderTexture2D target)
+{
+    size_t color = GetPixelDataSize(target.texture.width, target.texture.height, target.texture.format);
+    size_t depth = (size_t)target.texture.width * target.texture.height * 4;
+    MemStatsTrack(MEM_TEXTURE, name, 0, color + depth);
+}
+
+void MemStatsDraw(Font font)
+{
+    size_t cpu, gpu;
+    Totals(&cpu, &gpu);
+
+    size_t categoryCpu[MEM_CATEGORY_COUNT] = { 0 };
+    size_t categoryGpu[MEM_CATEGORY_COUNT] = { 0 };
+    for (int i = 0; i < entryCount; i++)
+    {
+        categoryCpu[entries[i].category] += entries[i].cpuBytes;
+        categoryGpu[entries[i].category] += entries[i].gpuBytes;
+    }
+
+    float x = 20, y = 100;
+    DrawRectangle(x - 10, y - 10, 300, 40 + (MEM_CATEGORY_COUNT + 2) * 18, Fade(BLACK, 0.75f));
+
+    char line[96];
+    snprintf(line, sizeof(line), "CPU %6.2f / %.0f MB", cpu / MB, cpuBudget / MB);
+    DrawTextEx(font, line, (Vector2){ x, y }, 16, 1, (cpu > cpuBudget) ? RED : GREEN);
+    snprintf(line, sizeof(line), "GPU %6.2f / %.0f MB", gpu / MB, gpuBudget / MB);
+    DrawTextEx(font, line, (Vector2){ x, y + 18 }, 16, 1, (gpu > gpuBudget) ? RED : GREEN);
+
+    for (int c = 0; c < MEM_CATEGORY_COUNT; c++)
+    {
+        snprintf(line, sizeof(line), "  %-10s %6.2f  %6.2f", categoryNames[c], categoryCpu[c] / MB, categoryGpu[c] / MB);
+        DrawTextEx(font, line, (Vector2){ x, y + 40 + c * 18 }, 16, 1, LIGHTGRAY);
+    }
+
+    size_t resident = ProcessResident();
+    if (resident)
+    {
+#ifdef PLATFORM_WEB
+        snprintf(line, sizeof(line), "wasm heap  %6.2f MB", resident / MB);
+#else
+        snprintf(line, sizeof(line), "process RSS %6.2f MB", resident / MB);
+#endif
+        DrawTextEx(font, line, (Vector2){ x, y + 40 + MEM_CATEGORY_COUNT * 18 }, 16, 1, GRAY);
+    }
+}
+
+void MemStatsReport(void)
+{
+    size_t cpu, gpu;
+    Totals(&cpu, &gpu);
+
+    TraceLog(LOG_INFO, "MEM: %-24s %-10s %10s %10s", "name", "category", "cpu KB", "gpu KB");
+    for (int i = 0; i < entryCount; i++)
+    {
+        TraceLog(LOG_INFO, "MEM: %-24s %-10s %10.1f %10.1f", entries[i].name, categoryNames[entries[i].category],
+                entries[i].cpuBytes / 1024.0, entries[i].gpuBytes / 1024.0);
+    }
+    TraceLog(LOG_INFO, "MEM: Tracked CPU %.2f MB (budget %.0f), GPU %.2f MB (budget %.0f), process %.2f MB",
+            cpu / MB, cpuBudget / MB, gpu / MB, gpuBudget / MB, ProcessResident() / MB);
+}
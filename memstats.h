@@ -0,0 +1,46 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - memory accounting
+ *
+ * Every asset and pool registers its CPU and GPU bytes here under a name (registering the
+ * same name again replaces the entry, so reloads don't double count). Totals are checked
+ * against a budget, shown in the F3 debug overlay and logged at exit.
+ *
+ * Budgets (MB) come from DEADTYPE_CPU_BUDGET_MB / DEADTYPE_GPU_BUDGET_MB; the CPU default
+ * matches the web build's initial heap (TOTAL_MEMORY).
+*******************************************************************************************/
+
+#ifndef MEMSTATS_H
+#define MEMSTATS_H
+
+#include "raylib.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define MEM_DEFAULT_CPU_BUDGET_MB  64
+#define MEM_DEFAULT_GPU_BUDGET_MB  64
+
+typedef enum {
+    MEM_AUDIO = 0,
+    MEM_FONT,
+    MEM_TEXTURE,       // textures and render targets
+    MEM_SIMULATION,    // GameState copies, particle and wall pools, rollback ring
+    MEM_CATEGORY_COUNT
+} MemCategory;
+
+/*******************************************************************************************
+*  FUNCTION DECLARATIONS
+*******************************************************************************************/
+
+void MemStatsInit(void);                                                      // Reads the budgets
+void MemStatsTrack(MemCategory category, const char *name, size_t cpuBytes, size_t gpuBytes);
+void MemStatsTrackSound(const char *name, Sound sound);
+void MemStatsTrackFont(const char *name, Font font);
+void MemStatsTrackTexture(const char *name, Texture2D texture);
+void MemStatsTrackRenderTexture(const char *name, RenderTexture2D target);
+void MemStatsDraw(Font font);                                                 // Debug overlay
+void MemStatsReport(void);                                                    // Logs the full table
+
+#endif // MEMSTATS_H
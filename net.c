@@ -0,0 +1,408 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - versus mode over UDP with rollback
+*******************************************************************************************/
+
+#include "raylib.h"
+#include "net.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <time.h>
+
+#ifndef PLATFORM_WEB
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <netdb.h>
+    #include <unistd.h>
+    #include <arpa/inet.h>
+    #include <netinet/in.h>
+    #include <sys/socket.h>
+#endif
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define NET_MAGIC           0x56544454u   // "DTTV"
+#define NET_MAX_PREDICTION  64            // ticks we may run ahead of the opponent's input
+#define NET_REDUNDANCY      32            // inputs resent in every packet (covers packet loss)
+#define NET_MAX_CATCH_UP    0.25f         // seconds of backlog dropped after a stall
+#define NET_TIMEOUT         5.0           // seconds of silence before the peer counts as gone
+
+// Held movement keys ride along in the unused top bits of GameInput.pressed
+#define NET_HELD_UP         (1ULL << 62)
+#define NET_HELD_DOWN       (1ULL << 63)
+
+/*******************************************************************************************
+*  DATA STRUCTURES
+*******************************************************************************************/
+
+// The only message: a run of our inputs plus how far we have the peer's
+typedef struct {
+    uint32_t magic;
+    uint32_t seed;                      // host's seed, adopted by the joiner
+    uint32_t ack;                       // we hold the receiver's inputs for every tick below this
+    uint32_t first;                     // tick of inputs[0]
+    uint32_t count;
+    uint64_t inputs[NET_REDUNDANCY];
+} NetPacket;
+
+/*******************************************************************************************
+*  GLOBAL VARIABLES
+*******************************************************************************************/
+
+static bool        sessionActive   = false;
+static bool        connected       = false;
+static bool        isHost          = false;
+static int         localPlayer     = 0;
+static uint32_t    sessionSeed     = 0;
+static double      sessionClock    = 0.0;   // sum of frame times since the session opened
+static double      lastHeard       = 0.0;
+static float       accumulator     = 0.0f;
+
+// Rollback state: snapshots[t] is the state before tick t was simulated
+static VersusState state;
+static VersusState snapshots[NET_RING];
+static uint64_t    localInputs[NET_RING];
+static uint64_t    remoteInputs[NET_RING];   // confirmed input per tick
+static uint64_t    usedRemote[NET_RING];     // what tick t was simulated with (confirmed or predicted)
+static uint32_t    remoteConfirmed = 0;      // every remote input below this tick is known
+static uint32_t    peerAck         = 0;      // the peer holds our inputs below this tick
+static uint64_t    pendingPressed  = 0;      // local presses waiting for the next tick
+static uint32_t    eventFrame      = 0;      // events of ticks below this were already reported
+static uint32_t    pendingEvents   = 0;
+static int         deepestRollback = 0;
+
+#ifndef PLATFORM_WEB
+static int                sock     = -1;
+static struct sockaddr_in peer;
+static bool               havePeer = false;
+#endif
+
+/*******************************************************************************************
+*  FUNCTION DEFINITIONS
+*******************************************************************************************/
+
+#ifndef PLATFORM_WEB
+
+static uint64_t EncodeInput(uint64_t pressed, bool up, bool down)
+{
+    return pressed | (up ? NET_HELD_UP : 0) | (down ? NET_HELD_DOWN : 0);
+}
+
+static GameInput DecodeInput(uint64_t bits)
+{
+    return (GameInput){
+        .pressed = bits & ~(NET_HELD_UP | NET_HELD_DOWN),
+        .up      = (bits & NET_HELD_UP) != 0,
+        .down    = (bits & NET_HELD_DOWN) != 0,
+    };
+}
+
+// Best guess for a tick we haven't heard about: same keys held, nothing newly pressed
+static uint64_t PredictRemote(void)
+{
+    if (remoteConfirmed == 0) return 0;
+    return remoteInputs[(remoteConfirmed - 1) % NET_RING] & (NET_HELD_UP | NET_HELD_DOWN);
+}
+
+// Snapshots, then advances the race by one tick
+static void SimulateTick(void)
+{
+    uint32_t tick   = state.frame;
+    uint64_t remote = (tick < remoteConfirmed) ? remoteInputs[tick % NET_RING] : PredictRemote();
+
+    VersusCopy(&snapshots[tick % NET_RING], &state);
+    usedRemote[tick % NET_RING] = remote;
+
+    GameInput inputs[VERSUS_PLAYERS];
+    inputs[localPlayer]     = DecodeInput(localInputs[tick % NET_RING]);
+    inputs[1 - localPlayer] = DecodeInput(remote);
+    VersusStep(&state, inputs, SIM_DT);
+
+    // Sounds only for ticks shown for the first time, not for re-simulated ones
+    if (tick >= eventFrame)
+    {
+        pendingEvents |= state.players[localPlayer].events;
+        eventFrame = tick + 1;
+    }
+}
+
+// Rewinds to the snapshot before tick and replays up to the present with corrected input
+static void Rollback(uint32_t tick)
+{
+    uint32_t present = state.frame;
+
+    VersusCopy(&state, &snapshots[tick % NET_RING]);
+    while (state.frame < present) SimulateTick();
+
+    if ((int)(present - tick) > deepestRollback) deepestRollback = present - tick;
+}
+
+static bool OpenSocket(int port)
+{
+    sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock < 0) return false;
+
+    struct sockaddr_in local = { .sin_family = AF_INET, .sin_port = htons(port), .sin_addr.s_addr = htonl(INADDR_ANY) };
+    if (bind(sock, (struct sockaddr *)&local, sizeof(local)) != 0 || fcntl(sock, F_SETFL, O_NONBLOCK) != 0)
+    {
+        TraceLog(LOG_WARNING, "NET: Can't bind UDP port %d (%s)", port, strerror(errno));
+        close(sock);
+        sock = -1;
+        return false;
+    }
+    return true;
+}
+
+// Reads every waiting packet; returns the earliest tick that was simulated with a wrong guess
+static uint32_t ReceivePackets(void)
+{
+    uint32_t rollbackFrom = state.frame;
+    NetPacket packet;
+    struct sockaddr_in from;
+    socklen_t fromSize = sizeof(from);
+    ssize_t   size;
+
+    while ((size = recvfrom(sock, &packet, sizeof(packet), 0, (struct sockaddr *)&from, &fromSize)) >= 0)
+    {
+        fromSize = sizeof(from);
+        if (size < (ssize_t)offsetof(NetPacket, inputs) || packet.magic != NET_MAGIC) continue;
+
+        // The host takes the first peer it hears from and ignores anyone else
+        if (!havePeer)
+        {
+            peer     = from;
+            havePeer = true;
+        }
+        else if (from.sin_addr.s_addr != peer.sin_addr.s_addr || from.sin_port != peer.sin_port) continue;
+
+        if (!connected)
+        {
+            connected = true;
+            if (!isHost)
+            {
+                sessionSeed = packet.seed;
+                VersusReset(&state, sessionSeed);
+            }
+            TraceLog(LOG_INFO, "NET: Connected to %s:%d", inet_ntoa(peer.sin_addr), ntohs(peer.sin_port));
+        }
+        lastHeard = sessionClock;
+
+        if (packet.ack > peerAck) peerAck = packet.ack;
+
+        uint32_t count = packet.count;
+        if (count > NET_REDUNDANCY) count = NET_REDUNDANCY;
+        if (size < (ssize_t)(offsetof(NetPacket, inputs) + count * sizeof(uint64_t))) continue;
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            uint32_t tick = packet.first + i;
+            if (tick != remoteConfirmed) continue;                 // old, or after a gap
+            if (tick >= state.frame + NET_MAX_PREDICTION) break;  // too far ahead for the ring
+
+            remoteInputs[tick % NET_RING] = packet.inputs[i];
+            if (tick < state.frame && usedRemote[tick % NET_RING] != packet.inputs[i] && tick < rollbackFrom)
+            {
+                rollbackFrom = tick;
+            }
+            remoteConfirmed++;
+        }
+    }
+
+    return rollbackFrom;
+}
+
+// Sends every input the peer hasn't acknowledged yet (doubles as the joiner's hello)
+static void SendInputs(void)
+{
+    if (!havePeer) return;
+
+    NetPacket packet = { .magic = NET_MAGIC, .seed = sessionSeed, .ack = remoteConfirmed, .first = peerAck };
+
+    uint32_t unacked = state.frame - peerAck;
+    packet.count = (unacked < NET_REDUNDANCY) ? unacked : NET_REDUNDANCY;
+    for (uint32_t i = 0; i < packet.count; i++) packet.inputs[i] = localInputs[(peerAck + i) % NET_RING];
+
+    sendto(sock, &packet, offsetof(NetPacket, inputs) + packet.count * sizeof(uint64_t), 0,
+            (struct sockaddr *)&peer, sizeof(peer));
+}
+
+bool NetSessionHost(int port)
+{
+    if (!OpenSocket(port)) return false;
+
+    sessionActive = true;
+    isHost        = true;
+    localPlayer   = 0;
+    sessionSeed   = (uint32_t)time(NULL);
+    VersusReset(&state, sessionSeed);
+
+    TraceLog(LOG_INFO, "NET: Hosting on UDP port %d", port);
+    return true;
+}
+
+bool NetSessionJoin(const char *address)
+{
+    char host[256];
+    snprintf(host, sizeof(host), "%s", address);
+
+    char *colon = strrchr(host, ':');
+    if (!colon)
+    {
+        TraceLog(LOG_WARNING, "NET: Expected <address>:<port>, got %s", address);
+        return false;
+    }
+    *colon = '\0';
+
+    struct addrinfo hints = { .ai_family = AF_INET, .ai_socktype = SOCK_DGRAM };
+    struct addrinfo *result = NULL;
+    if (getaddrinfo(host, colon + 1, &hints, &result) != 0 || !result)
+    {
+        TraceLog(LOG_WARNING, "NET: Can't resolve %s", address);
+        return false;
+    }
+    memcpy(&peer, result->ai_addr, sizeof(peer));
+    freeaddrinfo(result);
+
+    if (!OpenSocket(0)) return false;
+
+    sessionActive = true;
+    isHost        = false;
+    localPlayer   = 1;
+    havePeer      = true;
+
+    TraceLog(LOG_INFO, "NET: Joining %s", address);
+    return true;
+}
+
+void NetSessionClose(void)
+{
+    if (!sessionActive) return;
+
+    if (deepestRollback > 0) TraceLog(LOG_INFO, "NET: Deepest rollback was %d ticks", deepestRollback);
+    close(sock);
+    sock = -1;
+
+    sessionActive   = false;
+    connected       = false;
+    havePeer        = false;
+    sessionClock    = 0.0;
+    lastHeard       = 0.0;
+    accumulator     = 0.0f;
+    remoteConfirmed = 0;
+    peerAck         = 0;
+    pendingPressed  = 0;
+    eventFrame      = 0;
+    pendingEvents   = 0;
+    deepestRollback = 0;
+}
+
+void NetSessionPump(float frameTime, uint64_t pressed, bool up, bool down)
+{
+    if (!sessionActive) return;
+
+    sessionClock   += frameTime;
+    pendingPressed |= pressed;
+
+    if (!NetSessionPeerLost())
+    {
+        uint32_t rollbackFrom = ReceivePackets();
+        if (rollbackFrom < state.frame) Rollback(rollbackFrom);
+    }
+
+    if (connected)
+    {
+        accumulator += frameTime;
+        if (accumulator > NET_MAX_CATCH_UP) accumulator = NET_MAX_CATCH_UP;
+
+        while (accumulator >= SIM_DT)
+        {
+            // Too far ahead of the opponent: hold this tick until their input catches up
+            if ((int32_t)(state.frame - remoteConfirmed) >= NET_MAX_PREDICTION && !NetSessionPeerLost())
+            {
+                accumulator = SIM_DT;
+                break;
+            }
+
+            localInputs[state.frame % NET_RING] = EncodeInput(pendingPressed, up, down);
+            pendingPressed = 0;
+
+            SimulateTick();
+            accumulator -= SIM_DT;
+        }
+    }
+
+    SendInputs();
+}
+
+#else
+
+// No UDP sockets in the browser
+bool NetSessionHost(int port)
+{
+    (void)port;
+    return false;
+}
+
+bool NetSessionJoin(const char *address)
+{
+    (void)address;
+    return false;
+}
+
+void NetSessionClose(void)
+{
+}
+
+void NetSessionPump(float frameTime, uint64_t pressed, bool up, bool down)
+{
+    (void)frameTime; (void)pressed; (void)up; (void)down;
+}
+
+#endif
+
+bool NetSessionActive(void)
+{
+    return sessionActive;
+}
+
+bool NetSessionConnected(void)
+{
+    return connected;
+}
+
+bool NetSessionPeerLost(void)
+{
+    return connected && sessionClock - lastHeard > NET_TIMEOUT;
+}
+
+void NetSessionInterpolated(GameState *out, int player)
+{
+    if (state.frame == 0)
+    {
+        GameCopy(out, &state.players[player]);
+        return;
+    }
+
+    const GameState *previous = &snapshots[(state.frame - 1) % NET_RING].players[player];
+    GameInterpolate(out, previous, &state.players[player], accumulator / SIM_DT);
+}
+
+int NetSessionLocalPlayer(void)
+{
+    return localPlayer;
+}
+
+const VersusState *NetSessionState(void)
+{
+    return &state;
+}
+
+uint32_t NetSessionTakeEvents(void)
+{
+    uint32_t events = pendingEvents;
+    pendingEvents = 0;
+    return events;
+}
@@ -0,0 +1,41 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - versus mode over UDP with rollback
+ *
+ * Both peers simulate the whole VersusState every tick without waiting for each other:
+ * the opponent's input is predicted (keys held as before, nothing pressed) and when the
+ * real input arrives and differs, the state is restored from the snapshot taken before
+ * that tick and re-simulated up to the present within the same render frame.
+ *
+ * Start one side with --host <port> and the other with --join <address>:<port>
+ * (e.g. two windows on 127.0.0.1). Not available on web builds.
+*******************************************************************************************/
+
+#ifndef NET_H
+#define NET_H
+
+#include "sim.h"
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define NET_RING               128                                  // ticks of snapshots and inputs kept (power of two)
+#define NET_STATE_COPIES       ((NET_RING + 1) * VERSUS_PLAYERS)    // GameStates held by a session
+
+/*******************************************************************************************
+*  FUNCTION DECLARATIONS
+*******************************************************************************************/
+
+bool             NetSessionHost(int port);                   // false if the socket can't be bound
+bool             NetSessionJoin(const char *address);        // "host:port"
+void             NetSessionClose(void);
+bool             NetSessionActive(void);                     // a session was opened
+bool             NetSessionConnected(void);                  // both peers have heard from each other
+bool             NetSessionPeerLost(void);                   // nothing received for a while
+void             NetSessionPump(float frameTime, uint64_t pressed, bool up, bool down);
+void             NetSessionInterpolated(GameState *out, int player); // blend of the last two ticks
+int              NetSessionLocalPlayer(void);                // 0 for the host, 1 for the joiner
+const VersusState *NetSessionState(void);
+uint32_t         NetSessionTakeEvents(void);                 // local player's SIM_EVENT_*, never repeated by rollbacks
+
+#endif // NET_H
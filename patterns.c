@@ -0,0 +1,137 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - wall pattern library
+*******************************************************************************************/
+
+#include "patterns.h"
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*******************************************************************************************
+*  GLOBAL VARIABLES
+*******************************************************************************************/
+
+static const uint8_t *library     = NULL;   // the mapped file
+static size_t         librarySize = 0;
+static PatternHeader  header;
+
+/*******************************************************************************************
+*  FUNCTION DEFINITIONS
+*******************************************************************************************/
+
+int PatternLetterCode(char letter)
+{
+    if (letter >= 'A' && letter <= 'Z' && letter != 'W' && letter != 'S') return letter - 'A';
+    if (letter >= '0' && letter <= '9') return 26 + letter - '0';
+    return -1;
+}
+
+char PatternCodeLetter(int code)
+{
+    return (code < 26) ? 'A' + code : '0' + code - 26;
+}
+
+static size_t OffsetsStart(void)
+{
+    return sizeof(PatternHeader) + (size_t)header.levelCount * sizeof(PatternLevel);
+}
+
+bool PatternLibraryOpen(const char *path)
+{
+    PatternLibraryClose();
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    void *mapped = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && (size_t)info.st_size >= sizeof(PatternHeader))
+    {
+        mapped = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);   // the mapping keeps the file alive
+    if (mapped == MAP_FAILED) return false;
+
+    // Only the header and table sizes are checked here; records are checked as they're decoded
+    memcpy(&header, mapped, sizeof(header));
+    size_t tablesEnd = OffsetsStart() + ((size_t)header.wallCount + 1) * sizeof(uint32_t);
+    if (memcmp(header.magic, PATTERN_MAGIC, 4) || header.version != PATTERN_VERSION ||
+        header.rows != WALL_ROWS || header.maxThickness != WALL_MAX_THICKNESS ||
+        header.levelCount > (1u << 20) || header.wallCount > (1u << 24) || tablesEnd > (size_t)info.st_size)
+    {
+        munmap(mapped, info.st_size);
+        return false;
+    }
+
+    library     = mapped;
+    librarySize = info.st_size;
+    return true;
+}
+
+void PatternLibraryClose(void)
+{
+    if (library) munmap((void *)library, librarySize);
+    library     = NULL;
+    librarySize = 0;
+}
+
+int PatternLevelCount(void)
+{
+    return library ? (int)header.levelCount : 0;
+}
+
+static bool ReadLevel(int level, PatternLevel *out)
+{
+    if (!library || level < 0 || (uint32_t)level >= header.levelCount) return false;
+
+    memcpy(out, library + sizeof(PatternHeader) + (size_t)level * sizeof(PatternLevel), sizeof(*out));
+    out->name[PATTERN_NAME_LENGTH - 1] = '\0';
+    return out->wallCount > 0 && out->firstWall <= header.wallCount && out->wallCount <= header.wallCount - out->firstWall;
+}
+
+const char *PatternLevelName(int level)
+{
+    static PatternLevel entry;
+    return ReadLevel(level, &entry) ? entry.name : "";
+}
+
+int PatternDecodeWall(int level, uint32_t index, char cells[WALL_ROWS][WALL_MAX_THICKNESS])
+{
+    PatternLevel entry;
+    if (!ReadLevel(level, &entry)) return 0;
+
+    uint32_t wall = entry.firstWall + index % entry.wallCount;
+    uint32_t offsets[2];
+    memcpy(offsets, library + OffsetsStart() + (size_t)wall * sizeof(uint32_t), sizeof(offsets));
+    if (offsets[0] >= offsets[1] || offsets[1] > librarySize || offsets[1] - offsets[0] < 1 + WALL_ROWS) return 0;
+
+    const uint8_t *record    = library + offsets[0];
+    size_t         bitsLeft  = (size_t)(offsets[1] - offsets[0] - 1 - WALL_ROWS) * 8;
+    const uint8_t *masks     = record + 1;
+    const uint8_t *letters   = record + 1 + WALL_ROWS;
+    int            thickness = record[0];
+    size_t         bit       = 0;
+
+    if (thickness < 1 || thickness > WALL_MAX_THICKNESS) return 0;
+
+    for (int row = 0; row < WALL_ROWS; row++)
+    {
+        for (int col = 0; col < thickness; col++)
+        {
+            cells[row][col] = '\0';
+            if (!(masks[row] & (1u << col))) continue;
+            if (bit + PATTERN_LETTER_BITS > bitsLeft) return 0;
+
+            int code = 0;
+            for (int i = 0; i < PATTERN_LETTER_BITS; i++, bit++)
+            {
+                code |= ((letters[bit >> 3] >> (bit & 7)) & 1) << i;
+            }
+            if (code > 35) return 0;
+            cells[row][col] = PatternCodeLetter(code);
+        }
+    }
+    return thickness;
+}
@@ -0,0 +1,70 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - wall pattern library
+ *
+ * Curated levels (challenge and daily modes) are streams of hand-made walls. tools/wallc
+ * compiles them from the text files in levels/ into one binary file; the game maps it read-only
+ * and decodes a wall only when it scrolls in, so opening a library of any size costs one
+ * header check and no heap.
+ *
+ * File layout (little-endian):
+ *   PatternHeader
+ *   PatternLevel      levels[levelCount]
+ *   uint32_t          wallOffsets[wallCount + 1]   (from the start of the file; last = file size)
+ *   wall records      thickness (1 byte), one breakable mask byte per row (bit = column),
+ *                     then the breakable cells' letters, row by row, 6 bits each
+ *                     (0-25 = A-Z, 26-35 = 0-9, the same order as the input key bits)
+*******************************************************************************************/
+
+#ifndef PATTERNS_H
+#define PATTERNS_H
+
+#include "sim.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define PATTERN_MAGIC        "DTWL"
+#define PATTERN_VERSION      1
+#define PATTERN_NAME_LENGTH  24
+#define PATTERN_LETTER_BITS  6
+
+/*******************************************************************************************
+*  DATA STRUCTURES
+*******************************************************************************************/
+
+typedef struct {
+    char     magic[4];
+    uint16_t version;
+    uint8_t  rows;            // WALL_ROWS the library was compiled for
+    uint8_t  maxThickness;    // WALL_MAX_THICKNESS likewise
+    uint32_t levelCount;
+    uint32_t wallCount;
+} PatternHeader;
+
+typedef struct {
+    char     name[PATTERN_NAME_LENGTH];   // NUL padded
+    uint32_t firstWall;
+    uint32_t wallCount;
+} PatternLevel;
+
+/*******************************************************************************************
+*  FUNCTION DECLARATIONS
+*******************************************************************************************/
+
+bool        PatternLibraryOpen(const char *path);      // false if missing or malformed
+void        PatternLibraryClose(void);
+int         PatternLevelCount(void);                   // 0 without a library
+const char *PatternLevelName(int level);
+
+// Decodes wall index (wrapping around the level) into cells: a letter for a breakable block,
+// '\0' for a barrier. Returns the thickness, 0 when the level or record is unusable.
+int         PatternDecodeWall(int level, uint32_t index, char cells[WALL_ROWS][WALL_MAX_THICKNESS]);
+
+// Shared with tools/wallc
+int         PatternLetterCode(char letter);            // -1 for letters a block can't carry
+char        PatternCodeLetter(int code);
+
+#endif // PATTERNS_H
@@ -0,0 +1,283 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - simulation runner
+*******************************************************************************************/
+
+#include "runner.h"
+#include "trace.h"
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef SIM_THREADED
+    #include <pthread.h>
+#endif
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define SLOT_FRESH         4       // set on middleSlot when it holds an unread state
+#define SIM_MAX_CATCH_UP   0.25    // seconds of backlog dropped after a stall (window drag, breakpoint)
+#define SIM_IDLE_POLL      0.01    // how often an inactive sim thread checks for resume/reset
+
+/*******************************************************************************************
+*  DATA STRUCTURES
+*******************************************************************************************/
+
+typedef struct {
+    GameState state;
+    double    tickTime;    // runner clock time the tick was scheduled for
+} Snapshot;
+
+/*******************************************************************************************
+*  GLOBAL VARIABLES
+*******************************************************************************************/
+
+// Simulation-side working state (only touched by the sim thread / pump)
+static GameState sim;
+static double    simTickTime;
+
+// Triple buffer: the sim writes slots[backSlot], the renderer reads slots[frontSlot],
+// and the two trade through middleSlot without ever waiting on each other
+static Snapshot   slots[3];
+static int        backSlot   = 2;
+static int        frontSlot  = 0;
+static atomic_int middleSlot = 1;
+
+// Render -> sim
+static atomic_uint_fast64_t pendingPressed;
+static atomic_uint          heldKeys;          // bit 0: up, bit 1: down
+static atomic_bool          simActive;
+static atomic_uint_fast64_t resetRequest;      // runId << 32 | seed
+static atomic_bool          wordMode;          // applied at the next reset
+static atomic_int           patternLevel = -1; // likewise
+static uint32_t             nextRunId = 1;     // render thread only
+
+// Sim -> render
+static atomic_uint          pendingEvents;
+
+// Render side: the snapshot before the current front one, for interpolation
+static Snapshot             previous;
+
+#ifdef SIM_THREADED
+static pthread_t   simThread;
+static atomic_bool threadStop;
+#endif
+static bool        threadRunning = false;  // else SimRunnerPump steps inline (no threads, or none could start)
+static float       accumulator   = 0.0f;
+static double      inlineClock   = 0.0;    // sum of frame times handed to SimRunnerPump
+
+/*******************************************************************************************
+*  FUNCTION DEFINITIONS
+*******************************************************************************************/
+
+// Hands the working state to the renderer
+static void Publish(void)
+{
+    GameCopy(&slots[backSlot].state, &sim);
+    slots[backSlot].tickTime = simTickTime;
+    backSlot = atomic_exchange(&middleSlot, backSlot | SLOT_FRESH) & 3;
+}
+
+// Starts a new run if the renderer asked for one; true when the state changed
+static bool ApplyPendingReset(void)
+{
+    uint64_t request = atomic_load(&resetRequest);
+    uint32_t runId   = (uint32_t)(request >> 32);
+
+    if (runId == sim.runId) return false;
+
+    GameTuning tuning = defaultTuning;
+    tuning.wordMode     = atomic_load(&wordMode);
+    tuning.patternLevel = atomic_load(&patternLevel);
+    GameResetTuned(&sim, (uint32_t)request, runId, &tuning);
+    return true;
+}
+
+// One fixed step: consume input, simulate, publish
+static void RunTick(void)
+{
+    TRACE_ZONE("sim tick");
+    ApplyPendingReset();
+
+    unsigned int held = atomic_load(&heldKeys);
+    GameInput input = {
+        .pressed = atomic_exchange(&pendingPressed, 0),
+        .up      = held & 1,
+        .down    = held & 2,
+    };
+
+    GameStep(&sim, &input, SIM_DT);
+    if (sim.events) atomic_fetch_or(&pendingEvents, sim.events);
+
+    Publish();
+}
+
+#ifdef SIM_THREADED
+
+static double NowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void SleepSeconds(double seconds)
+{
+    struct timespec ts = { (time_t)seconds, (long)((seconds - (time_t)seconds) * 1e9) };
+    nanosleep(&ts, NULL);
+}
+
+// Sim thread: ticks on a fixed schedule, independent of how long frames take to draw
+static void *SimThreadMain(void *arg)
+{
+    (void)arg;
+    TRACE_THREAD("sim");
+    double nextTick = NowSeconds();
+
+    while (!atomic_load(&threadStop))
+    {
+        double now = NowSeconds();
+
+        if (!atomic_load(&simActive))
+        {
+            if (ApplyPendingReset()) Publish();
+            SleepSeconds(SIM_IDLE_POLL);
+            nextTick = NowSeconds();
+            continue;
+        }
+
+        if (now < nextTick)
+        {
+            SleepSeconds(nextTick - now);
+            continue;
+        }
+
+        if (now - nextTick > SIM_MAX_CATCH_UP) nextTick = now;
+
+        simTickTime = nextTick;
+        RunTick();
+        nextTick += SIM_DT;
+    }
+
+    return NULL;
+}
+
+#endif
+
+// Time base shared by tick stamps and the renderer
+static double RunnerClock(void)
+{
+#ifdef SIM_THREADED
+    if (threadRunning) return NowSeconds();
+#endif
+    return inlineClock;
+}
+
+uint32_t SimRunnerStart(uint32_t seed)
+{
+    GameReset(&sim, seed, nextRunId);
+    atomic_store(&resetRequest, ((uint64_t)nextRunId << 32) | seed);
+    for (int i = 0; i < 3; i++) slots[i] = (Snapshot){ sim, 0.0 };
+    previous = slots[0];
+
+#ifdef SIM_THREADED
+    atomic_store(&threadStop, false);
+    threadRunning = (pthread_create(&simThread, NULL, SimThreadMain, NULL) == 0);
+    if (!threadRunning) TraceLog(LOG_WARNING, "SIM: No simulation thread, stepping on the main thread");
+#endif
+
+    return nextRunId;
+}
+
+void SimRunnerStop(void)
+{
+#ifdef SIM_THREADED
+    if (!threadRunning) return;
+    atomic_store(&threadStop, true);
+    pthread_join(simThread, NULL);
+    threadRunning = false;
+#endif
+}
+
+void SimRunnerSetActive(bool active)
+{
+    atomic_store(&simActive, active);
+}
+
+void SimRunnerSetWordMode(bool enabled)
+{
+    atomic_store(&wordMode, enabled);
+}
+
+void SimRunnerSetPatternLevel(int level)
+{
+    atomic_store(&patternLevel, level);
+}
+
+uint32_t SimRunnerRequestReset(uint32_t seed)
+{
+    nextRunId++;
+    atomic_store(&pendingPressed, 0);
+    atomic_store(&resetRequest, ((uint64_t)nextRunId << 32) | seed);
+    return nextRunId;
+}
+
+void SimRunnerSubmitInput(uint64_t pressed, bool up, bool down)
+{
+    if (pressed) atomic_fetch_or(&pendingPressed, pressed);
+    atomic_store(&heldKeys, (up ? 1u : 0u) | (down ? 2u : 0u));
+}
+
+void SimRunnerPump(float frameTime)
+{
+    if (threadRunning) return;
+    if (ApplyPendingReset()) Publish();
+
+    if (!atomic_load(&simActive))
+    {
+        accumulator = 0.0f;
+        return;
+    }
+
+    inlineClock += frameTime;
+    accumulator += frameTime;
+    if (accumulator > SIM_MAX_CATCH_UP) accumulator = SIM_MAX_CATCH_UP;
+
+    while (accumulator >= SIM_DT)
+    {
+        accumulator -= SIM_DT;
+        simTickTime = inlineClock - accumulator;
+        RunTick();
+    }
+}
+
+const GameState *SimRunnerAcquireSnapshot(void)
+{
+    if (atomic_load(&middleSlot) & SLOT_FRESH)
+    {
+        // The old front slot goes back to the sim below; only its blended fields are needed
+        GameCopy(&previous.state, &slots[frontSlot].state);
+        previous.tickTime = slots[frontSlot].tickTime;
+        frontSlot         = atomic_exchange(&middleSlot, frontSlot) & 3;
+    }
+    return &slots[frontSlot].state;
+}
+
+void SimRunnerAcquireInterpolated(GameState *out)
+{
+    SimRunnerAcquireSnapshot();
+    const Snapshot *current = &slots[frontSlot];
+
+    // Draw one tick in the past so there is (almost) always a newer state to blend towards
+    double renderTime = RunnerClock() - SIM_DT;
+    double span       = current->tickTime - previous.tickTime;
+    float  alpha      = (span > 0.0) ? (float)((renderTime - previous.tickTime) / span) : 1.0f;
+
+    GameInterpolate(out, &previous.state, &current->state, alpha);
+}
+
+uint32_t SimRunnerTakeEvents(void)
+{
+    return atomic_exchange(&pendingEvents, 0);
+}
@@ -0,0 +1,37 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - simulation runner
+ *
+ * Drives GameStep at SIM_TICK_RATE independently of the display. Where threads are
+ * available the simulation gets its own thread and hands finished states to the render
+ * thread through a lock-free triple buffer; otherwise (no threads, or the thread can't be
+ * started) SimRunnerPump steps it inline.
+*******************************************************************************************/
+
+#ifndef RUNNER_H
+#define RUNNER_H
+
+#include "sim.h"
+
+#if !defined(PLATFORM_WEB) || defined(__EMSCRIPTEN_PTHREADS__)
+    #define SIM_THREADED 1
+#endif
+
+#define SIM_RUNNER_STATE_COPIES  5   // working state, triple buffer, previous snapshot
+
+/*******************************************************************************************
+*  FUNCTION DECLARATIONS
+*******************************************************************************************/
+
+uint32_t         SimRunnerStart(uint32_t seed);              // returns the runId of the first run
+void             SimRunnerStop(void);
+void             SimRunnerSetActive(bool active);            // false while paused or in a menu
+void             SimRunnerSetWordMode(bool enabled);         // takes effect at the next reset
+void             SimRunnerSetPatternLevel(int level);        // -1 for random walls; likewise
+uint32_t         SimRunnerRequestReset(uint32_t seed);       // returns the runId of the new run
+void             SimRunnerSubmitInput(uint64_t pressed, bool up, bool down);
+void             SimRunnerPump(float frameTime);             // steps inline when not threaded
+const GameState *SimRunnerAcquireSnapshot(void);             // latest state, valid until next call
+void             SimRunnerAcquireInterpolated(GameState *out); // blend of the last two states at render time
+uint32_t         SimRunnerTakeEvents(void);                  // SIM_EVENT_* raised since last call
+
+#endif // RUNNER_H
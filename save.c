@@ -0,0 +1,358 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - persistent personal best & session history
+ *
+ * Sessions are appended to a log of fixed-size, checksummed records. A crash mid-write can
+ * only tear the last record, which is dropped (and truncated away) on the next load.
+ * On native a writer thread owns the file so fsync never runs on the frame loop; on web
+ * the log lives in IDBFS and is flushed to IndexedDB asynchronously.
+*******************************************************************************************/
+
+#include "raylib.h"
+#include "save.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#ifdef PLATFORM_WEB
+    #include <emscripten/emscripten.h>
+#else
+    #include <pthread.h>
+#endif
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define SAVE_MAGIC       0x52535444u   // "DTSR"
+#define SAVE_QUEUE_SIZE  16
+#define SAVE_FILE_NAME   "history.log"
+
+/*******************************************************************************************
+*  DATA STRUCTURES
+*******************************************************************************************/
+
+typedef struct {
+    uint32_t      magic;
+    uint32_t      crc;       // CRC-32 of record
+    SessionRecord record;
+} LogEntry;
+
+/*******************************************************************************************
+*  GLOBAL VARIABLES
+*******************************************************************************************/
+
+static char          saveDir[400];
+static char          logPath[512];
+static bool          storeReady   = false;
+static int           bestScore    = 0;
+
+// In-memory history ring (frame thread only)
+static SessionRecord history[SAVE_HISTORY_MAX];
+static int           historyHead  = 0;
+static int           historyCount = 0;
+
+// Pending writes: consumed by the writer thread (native) or SaveStorePump (web)
+static SessionRecord queue[SAVE_QUEUE_SIZE];
+static int           queueHead    = 0;
+static int           queueCount   = 0;
+
+#ifdef PLATFORM_WEB
+static bool          syncPending  = false;  // log changed since last IndexedDB flush
+static bool          syncInFlight = false;
+#else
+static pthread_t       writerThread;
+static pthread_mutex_t queueLock     = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  queueSignal   = PTHREAD_COND_INITIALIZER;
+static bool            writerRunning = false;
+#endif
+
+/*******************************************************************************************
+*  FUNCTION DEFINITIONS
+*******************************************************************************************/
+
+// Bitwise CRC-32 (records are tiny, a table isn't worth it)
+static uint32_t Crc32(const void *data, size_t size)
+{
+    const unsigned char *bytes = data;
+    uint32_t crc = 0xFFFFFFFFu;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        crc ^= bytes[i];
+        for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xEDB88320u & -(crc & 1));
+    }
+    return ~crc;
+}
+
+// Adds a record to the in-memory history and PB
+static void RememberSession(SessionRecord record)
+{
+    history[historyHead] = record;
+    historyHead = (historyHead + 1) % SAVE_HISTORY_MAX;
+    if (historyCount < SAVE_HISTORY_MAX) historyCount++;
+
+    if (record.score > bestScore) bestScore = record.score;
+}
+
+// Creates every directory along path (mkdir -p)
+static void MakeDirs(char *path)
+{
+    for (char *p = path + 1; *p; p++)
+    {
+        if (*p != '/') continue;
+        *p = '\0';
+        mkdir(path, 0755);
+        *p = '/';
+    }
+    mkdir(path, 0755);
+}
+
+// Picks the platform data directory for the log
+static void BuildLogPath(void)
+{
+#ifdef PLATFORM_WEB
+    snprintf(saveDir, sizeof(saveDir), "/save");
+    snprintf(logPath, sizeof(logPath), "%s/%s", saveDir, SAVE_FILE_NAME);
+#else
+    const char *override = getenv("DEADTYPE_SAVE_DIR");
+    const char *xdg      = getenv("XDG_DATA_HOME");
+    const char *home     = getenv("HOME");
+
+    if (override && *override)      snprintf(saveDir, sizeof(saveDir), "%s", override);
+#if defined(__APPLE__)
+    else if (home && *home)         snprintf(saveDir, sizeof(saveDir), "%s/Library/Application Support/0xdead-type", home);
+#else
+    else if (xdg && *xdg)           snprintf(saveDir, sizeof(saveDir), "%s/0xdead-type", xdg);
+    else if (home && *home)         snprintf(saveDir, sizeof(saveDir), "%s/.local/share/0xdead-type", home);
+#endif
+    else                            snprintf(saveDir, sizeof(saveDir), ".");
+
+    (void)xdg;
+    MakeDirs(saveDir);
+    snprintf(logPath, sizeof(logPath), "%s/%s", saveDir, SAVE_FILE_NAME);
+#endif
+}
+
+// Reads every intact record; a torn or corrupt tail is truncated so appends stay aligned
+static void LoadLog(void)
+{
+    int fd = open(logPath, O_RDWR);
+    if (fd < 0) return;
+
+    LogEntry entry;
+    off_t    goodSize = 0;
+
+    while (read(fd, &entry, sizeof(entry)) == (ssize_t)sizeof(entry))
+    {
+        if (entry.magic != SAVE_MAGIC || entry.crc != Crc32(&entry.record, sizeof(entry.record))) break;
+
+        RememberSession(entry.record);
+        goodSize += sizeof(entry);
+    }
+
+    if (lseek(fd, 0, SEEK_END) != goodSize)
+    {
+        TraceLog(LOG_WARNING, "SAVE: Dropping damaged tail of %s", logPath);
+        if (ftruncate(fd, goodSize) != 0) TraceLog(LOG_WARNING, "SAVE: Truncate failed (%s)", strerror(errno));
+    }
+
+    close(fd);
+}
+
+// Writes one whole record and makes it durable
+static void AppendToLog(int fd, SessionRecord record)
+{
+    LogEntry entry = { SAVE_MAGIC, Crc32(&record, sizeof(record)), record };
+    const char *bytes = (const char *)&entry;
+    size_t written = 0;
+
+    while (written < sizeof(entry))
+    {
+        ssize_t n = write(fd, bytes + written, sizeof(entry) - written);
+        if (n < 0)
+        {
+            if (errno == EINTR) continue;
+            TraceLog(LOG_WARNING, "SAVE: Write failed (%s)", strerror(errno));
+            return;
+        }
+        written += n;
+    }
+
+    fsync(fd);
+}
+
+#ifdef PLATFORM_WEB
+
+// Called from JS once IndexedDB has been copied into /save
+EMSCRIPTEN_KEEPALIVE void SaveStoreOnMounted(int error)
+{
+    if (error) TraceLog(LOG_WARNING, "SAVE: IndexedDB unavailable, history won't persist");
+    LoadLog();
+    storeReady = true;
+}
+
+EMSCRIPTEN_KEEPALIVE void SaveStoreOnSynced(int error)
+{
+    if (error) TraceLog(LOG_WARNING, "SAVE: IndexedDB flush failed");
+    syncInFlight = false;
+}
+
+#else
+
+// Writer thread: drains the queue, never holding the lock across disk I/O
+static void *WriterMain(void *arg)
+{
+    (void)arg;
+    int fd = open(logPath, O_WRONLY | O_APPEND | O_CREAT, 0644);
+    if (fd < 0) TraceLog(LOG_WARNING, "SAVE: Can't open %s (%s)", logPath, strerror(errno));
+
+    pthread_mutex_lock(&queueLock);
+    for (;;)
+    {
+        while (queueCount == 0 && writerRunning) pthread_cond_wait(&queueSignal, &queueLock);
+        if (queueCount == 0) break;
+
+        SessionRecord record = queue[queueHead];
+        queueHead = (queueHead + 1) % SAVE_QUEUE_SIZE;
+        queueCount--;
+
+        pthread_mutex_unlock(&queueLock);
+        if (fd >= 0) AppendToLog(fd, record);
+        pthread_mutex_lock(&queueLock);
+    }
+    pthread_mutex_unlock(&queueLock);
+
+    if (fd >= 0) close(fd);
+    return NULL;
+}
+
+#endif
+
+void SaveStoreOpen(void)
+{
+    BuildLogPath();
+
+#ifdef PLATFORM_WEB
+    // Mounting IDBFS is async: history shows up a few frames later via SaveStoreOnMounted
+    EM_ASM({
+        FS.mkdir('/save');
+        FS.mount(IDBFS, {}, '/save');
+        FS.syncfs(true, function (err) { ccall('SaveStoreOnMounted', null, ['number'], [err ? 1 : 0]); });
+    });
+#else
+    LoadLog();
+    storeReady    = true;
+    writerRunning = true;
+    if (pthread_create(&writerThread, NULL, WriterMain, NULL) != 0)
+    {
+        writerRunning = false;
+        TraceLog(LOG_WARNING, "SAVE: Writer thread failed to start, history won't persist");
+    }
+#endif
+}
+
+void SaveStorePump(void)
+{
+#ifdef PLATFORM_WEB
+    if (!storeReady) return;
+
+    if (queueCount > 0)
+    {
+        int fd = open(logPath, O_WRONLY | O_APPEND | O_CREAT, 0644);
+        while (queueCount > 0)
+        {
+            if (fd >= 0) AppendToLog(fd, queue[queueHead]);
+            queueHead = (queueHead + 1) % SAVE_QUEUE_SIZE;
+            queueCount--;
+        }
+        if (fd >= 0) close(fd);
+        syncPending = true;
+    }
+
+    if (syncPending && !syncInFlight)
+    {
+        syncPending  = false;
+        syncInFlight = true;
+        EM_ASM({
+            FS.syncfs(false, function (err) { ccall('SaveStoreOnSynced', null, ['number'], [err ? 1 : 0]); });
+        });
+    }
+#endif
+}
+
+bool SaveStoreReady(void)
+{
+    return storeReady;
+}
+
+int SaveStoreGetBest(void)
+{
+    return bestScore;
+}
+
+const char *SaveStoreGetDir(void)
+{
+    return saveDir;
+}
+
+int SaveStoreGetHistory(SessionRecord *out, int max)
+{
+    int count = (max < historyCount) ? max : historyCount;
+
+    for (int i = 0; i < count; i++)
+    {
+        out[i] = history[(historyHead - 1 - i + SAVE_HISTORY_MAX) % SAVE_HISTORY_MAX];
+    }
+    return count;
+}
+
+void SaveStoreAppend(SessionRecord record)
+{
+    if (record.timestamp == 0) record.timestamp = (int64_t)time(NULL);
+    RememberSession(record);
+
+#ifndef PLATFORM_WEB
+    if (!writerRunning) return;
+    pthread_mutex_lock(&queueLock);
+#endif
+
+    if (queueCount < SAVE_QUEUE_SIZE)
+    {
+        queue[(queueHead + queueCount) % SAVE_QUEUE_SIZE] = record;
+        queueCount++;
+    }
+    else TraceLog(LOG_WARNING, "SAVE: Write queue full, session dropped");
+
+#ifndef PLATFORM_WEB
+    pthread_cond_signal(&queueSignal);
+    pthread_mutex_unlock(&queueLock);
+#endif
+}
+
+void SaveStoreRequestSync(void)
+{
+#ifdef PLATFORM_WEB
+    syncPending = true;
+#endif
+}
+
+void SaveStoreClose(void)
+{
+#ifdef PLATFORM_WEB
+    SaveStorePump();
+#else
+    if (!writerRunning) return;
+
+    pthread_mutex_lock(&queueLock);
+    writerRunning = false;
+    pthread_cond_signal(&queueSignal);
+    pthread_mutex_unlock(&queueLock);
+
+    pthread_join(writerThread, NULL);
+#endif
+}
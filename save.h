@@ -0,0 +1,52 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - persistent personal best & session history
+*******************************************************************************************/
+
+#ifndef SAVE_H
+#define SAVE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define SAVE_HISTORY_MAX   64      // most recent sessions kept in memory
+
+// How a session ended
+typedef enum {
+    CAUSE_NONE = 0,
+    CAUSE_BLOCK,        // flew into a letter block
+    CAUSE_BARRIER,      // flew into an unbreakable block
+    CAUSE_ABANDONED,    // restarted or quit to menu mid-run
+} DeathCause;
+
+/*******************************************************************************************
+*  DATA STRUCTURES
+*******************************************************************************************/
+
+// One finished run. Stored verbatim in the append-only log, so keep it fixed-size.
+typedef struct {
+    int64_t timestamp;   // unix seconds at session end
+    int32_t score;
+    float   duration;    // seconds of actual play
+    int32_t keystrokes;
+    int32_t cause;       // DeathCause
+} SessionRecord;
+
+/*******************************************************************************************
+*  FUNCTION DECLARATIONS
+*******************************************************************************************/
+
+void SaveStoreOpen(void);                          // Load history and start the background writer
+void SaveStorePump(void);                          // Call once per frame (finishes async web storage work)
+bool SaveStoreReady(void);                         // True once history has been loaded
+int  SaveStoreGetBest(void);                       // Best score across all stored sessions
+int  SaveStoreGetHistory(SessionRecord *out, int max); // Most recent first, returns count
+const char *SaveStoreGetDir(void);                 // Directory holding the log (valid after SaveStoreOpen)
+void SaveStoreAppend(SessionRecord record);        // Queue a record, never blocks on disk
+void SaveStoreRequestSync(void);                   // Other files in the save dir changed (web: flush to IndexedDB)
+void SaveStoreClose(void);                         // Flush pending writes and stop the writer
+
+#endif // SAVE_H
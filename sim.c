@@ -0,0 +1,1085 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - gameplay simulation
+*******************************************************************************************/
+
+#include "sim.h"
+#include "save.h"
+#include "patterns.h"
+#include "trace.h"
+#include <string.h>
+#include <stddef.h>
+#include <math.h>
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+// Blocks tested per batch by the swept hull collision (GCC/Clang vector extensions, lowered
+// to SSE/NEON/wasm SIMD where the target has it and to scalar code otherwise)
+#define HULL_LANES 8
+typedef float   HullFloats __attribute__((vector_size(HULL_LANES * sizeof(float))));
+typedef int32_t HullInts   __attribute__((vector_size(HULL_LANES * sizeof(int32_t))));
+
+// The web-simd build (-msimd128) also runs the particle and black hole kernels four lanes
+// at a time. Other builds keep the scalar loops, so native peers stay bit-identical.
+#if defined(__wasm_simd128__) && !defined(SIM_SIMD)
+    #define SIM_SIMD 1
+#endif
+
+#ifdef SIM_SIMD
+    #define SIMD_LANES 4
+    typedef float   SimdFloats __attribute__((vector_size(SIMD_LANES * sizeof(float))));
+    typedef int32_t SimdInts   __attribute__((vector_size(SIMD_LANES * sizeof(int32_t))));
+#endif
+
+/*******************************************************************************************
+*  GLOBAL VARIABLES
+*******************************************************************************************/
+
+void (*simTelemetrySink)(const TelemetryRecord *record) = NULL;
+
+const GameTuning defaultTuning = {
+    .breakablePercent    = 80,
+    .digitPercent        = 5,
+    .blackHoleOdds       = 200,
+    .wallSpeedBase       = 100,
+    .wallSpeedPerScore   = 2,
+    .thicknessEvery      = 10,
+    .keyCooldown         = KEY_COOLDOWN_TIME,
+    .wrongKeyLockout     = WRONG_KEY_LOCKOUT,
+    .wrongKeyStreakLimit = 3,
+    .patternLevel        = -1,
+};
+
+/*******************************************************************************************
+*  FUNCTION DEFINITIONS
+*******************************************************************************************/
+
+// Reports one event to the telemetry sink, if any
+static void Emit(const GameState *gs, TelemetryType type, char key, int count, float x, float y, float value)
+{
+    if (!simTelemetrySink || gs->telemetryOff) return;
+
+    TelemetryRecord record = {
+        .runId = gs->runId,
+        .time  = (float)gs->time,
+        .type  = type,
+        .key   = key,
+        .count = (uint16_t)count,
+        .x     = x,
+        .y     = y,
+        .value = value,
+    };
+    simTelemetrySink(&record);
+}
+
+// Returns a color based on the letter of the block
+Color GetBlockColor(char letter)
+{
+    switch (letter)
+    {
+        case '0': return (Color){ 255, 255, 255, 204 }; // Special color for the Black Hole block
+        case 'A': return RED;
+        case 'B': return ORANGE;
+        case 'C': return GOLD;
+        case 'D': return GREEN;
+        case 'E': return SKYBLUE;
+        case 'F': return BLUE;
+        case 'G': return PURPLE;
+        case 'H': return PINK;
+        case 'I': return BEIGE;
+        case 'J': return MAROON;
+        case 'K': return DARKGREEN;
+        case 'L': return DARKBLUE;
+        case 'M': return DARKPURPLE;
+        case 'N': return DARKBROWN;
+        case 'O': return MAGENTA;
+        case 'P': return LIME;
+        case 'Q': return CYAN;
+        case 'R': return YELLOW;
+        case 'S': return GRAY;
+        case 'T': return DARKGRAY;
+        case 'U': return VIOLET;
+        case 'V': return DARKGOLD;
+        case 'W': return GRAY;
+        case 'X': return PURPLE;
+        case 'Y': return DARKORANGE;
+        case 'Z': return LIGHTGREEN;
+        case '1': return WHITE;
+        case '2': return GOLD;
+        case '3': return ORANGE;
+        case '4': return DARKRED;
+        case '5': return AQUA;
+        case '6': return TAN;
+        case '7': return PLUM;
+        case '8': return TEAL;
+        case '9': return SALMON;
+        default:  return BLACK;
+    }
+}
+
+// Maps a block letter to its bit in GameInput.pressed
+uint64_t InputKeyBit(char letter)
+{
+    if (letter >= 'A' && letter <= 'Z') return 1ULL << (letter - 'A');
+    if (letter >= '0' && letter <= '9') return 1ULL << (26 + letter - '0');
+    return 0;
+}
+
+// Inverse of InputKeyBit, for the lowest key in a pressed mask
+static char LowestKeyLetter(uint64_t keys)
+{
+    int bit = __builtin_ctzll(keys);
+    return (bit < 26) ? 'A' + bit : '0' + bit - 26;
+}
+
+// Inclusive random integer from the run's own generator (xorshift32)
+int SimRandom(GameState *gs, int min, int max)
+{
+    uint32_t x = gs->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    gs->rng = x;
+
+    return min + (int)(x % (uint32_t)(max - min + 1));
+}
+
+// Applies a screen shake by setting an intensity
+void ApplyScreenShake(GameState *gs, float intensity)
+{
+    gs->screenShake = intensity;
+}
+
+// Updates the screen shake effect over time
+static void UpdateScreenShake(GameState *gs, float deltaTime)
+{
+    if (gs->screenShake > 0)
+    {
+        gs->screenShake -= deltaTime * 2.0f; // Reduce shake over time
+        if (gs->screenShake < 0) gs->screenShake = 0;
+    }
+}
+
+// Spawns new particles at a given position with a given color
+void SpawnParticles(GameState *gs, Vector2 position, Color color)
+{
+    int numParticles = (gs->gameOverTriggered) ? 30 : 10; // More particles on Game Over
+
+    for (int i = 0; i < numParticles; i++)
+    {
+        Particle *particle = &gs->particles[gs->particleIndex % MAX_PARTICLES]; // Circular buffer
+
+        particle->position = position;
+
+        // More dramatic explosion on Game Over
+        float speed = SimRandom(gs, 30, (gs->gameOverTriggered) ? 100 : 60) / 10.0f;
+        float angle = SimRandom(gs, 0, 360) * DEG2RAD;
+        particle->velocity = (Vector2){ cosf(angle) * speed, sinf(angle) * speed };
+
+        particle->lifetime = (gs->gameOverTriggered) ? 1.5f : 0.8f; // Longer duration on death
+        particle->size     = SimRandom(gs, 3, (gs->gameOverTriggered) ? 7 : 5);
+        particle->color    = color;
+
+        gs->particleIndex = (gs->particleIndex + 1) % MAX_PARTICLES;
+    }
+}
+
+#ifdef SIM_SIMD
+
+// Moves live particles, four per pass. Dead lanes are computed but never stored.
+static void UpdateParticles(GameState *gs, float deltaTime)
+{
+    TRACE_ZONE("UpdateParticles");
+    for (int base = 0; base < MAX_PARTICLES; base += SIMD_LANES)
+    {
+        Particle  *particles = &gs->particles[base];
+        SimdFloats px, py, vx, vy, lifetime;
+        for (int l = 0; l < SIMD_LANES; l++)
+        {
+            px[l]       = particles[l].position.x;
+            py[l]       = particles[l].position.y;
+            vx[l]       = particles[l].velocity.x;
+            vy[l]       = particles[l].velocity.y;
+            lifetime[l] = particles[l].lifetime;
+        }
+
+        SimdInts alive = lifetime > 0;
+        if (!(alive[0] | alive[1] | alive[2] | alive[3])) continue;
+
+        px += vx * deltaTime * 60.0f;
+        py += vy * deltaTime * 60.0f;
+        vy += 3.0f * deltaTime;
+        lifetime -= deltaTime;
+
+        for (int l = 0; l < SIMD_LANES; l++)
+        {
+            if (!alive[l]) continue;
+            particles[l].position = (Vector2){ px[l], py[l] };
+            particles[l].velocity.y = vy[l];
+            particles[l].lifetime   = lifetime[l];
+        }
+    }
+}
+
+#else
+
+// Moves live particles
+static void UpdateParticles(GameState *gs, float deltaTime)
+{
+    TRACE_ZONE("UpdateParticles");
+    for (int i = 0; i < MAX_PARTICLES; i++)
+    {
+        Particle *particle = &gs->particles[i];
+        if (particle->lifetime <= 0) continue;
+
+        // Apply velocity
+        particle->position.x += particle->velocity.x * deltaTime * 60;
+        particle->position.y += particle->velocity.y * deltaTime * 60;
+
+        // Apply slight gravity (frame-rate independent)
+        particle->velocity.y += 3.0f * deltaTime;
+
+        // Reduce lifetime
+        particle->lifetime -= deltaTime;
+    }
+}
+
+#endif
+
+// Picks a random typeable letter (W and S are movement keys, so avoid them)
+static char RandomBlockLetter(GameState *gs)
+{
+    char letter;
+    do {
+        letter = 'A' + SimRandom(gs, 0, 25);
+    } while (letter == 'W' || letter == 'S');
+    return letter;
+}
+
+// Word mode: a target is one row of one wall
+static int WordTarget(const GameState *gs, const Wall *wall, int row)
+{
+    return (int)(wall - gs->walls) * WALL_ROWS + row;
+}
+
+// Drops the trie nodes of removed words, keeping what has been typed so far
+static void RebuildWordMatcher(GameState *gs)
+{
+    char typed[WORD_MAX_LENGTH + 1];
+    int  typedLength = WordMatcherTyped(&gs->matcher, typed);
+
+    WordMatcherClear(&gs->matcher);
+    for (int i = 0; i < WALL_COUNT; i++)
+    {
+        Wall *wall = &gs->walls[i];
+        for (int row = 0; row < WALL_ROWS; row++)
+        {
+            if (wall->wordLive & (1u << row)) WordMatcherAdd(&gs->matcher, wall->words[row], WordTarget(gs, wall, row));
+        }
+    }
+    WordMatcherLink(&gs->matcher);
+
+    for (int i = 0; i < typedLength; i++) WordMatcherFeed(&gs->matcher, typed[i]);
+}
+
+static void AddWordTarget(GameState *gs, Wall *wall, int row)
+{
+    // Live words always fit once the dead ones are gone
+    if (!WordMatcherAdd(&gs->matcher, wall->words[row], WordTarget(gs, wall, row)))
+    {
+        RebuildWordMatcher(gs);
+        WordMatcherAdd(&gs->matcher, wall->words[row], WordTarget(gs, wall, row));
+    }
+    wall->wordLive |= 1u << row;
+}
+
+static void RemoveWordTarget(GameState *gs, Wall *wall, int row)
+{
+    if (!(wall->wordLive & (1u << row))) return;
+
+    WordMatcherRemove(&gs->matcher, wall->words[row], WordTarget(gs, wall, row));
+    wall->wordLive &= ~(1u << row);
+}
+
+static void RemoveWallWords(GameState *gs, Wall *wall)
+{
+    for (int row = 0; row < WALL_ROWS; row++) RemoveWordTarget(gs, wall, row);
+}
+
+// Gives every row of a fresh wall a word. A row holding a black hole block gets 0x0000;
+// its blocks keep the rainbow, the others take the word's first letter as their color.
+static void AssignWallWords(GameState *gs, Wall *wall)
+{
+    for (int row = 0; row < WALL_ROWS; row++)
+    {
+        bool blackHole = false;
+        for (int col = 0; col < wall->thickness; col++)
+        {
+            if (wall->blocks[row][col].breakable && wall->blocks[row][col].letter == '0') blackHole = true;
+        }
+
+        char *word = wall->words[row];
+        if (blackHole)
+        {
+            strcpy(word, "0X0000");
+        }
+        else if (SimRandom(gs, 1, 3) == 1)
+        {
+            static const char hexDigits[] = "0123456789ABCDEF";
+            strcpy(word, "0X");
+            for (int i = 2; i < 6; i++) word[i] = hexDigits[SimRandom(gs, 0, 15)];
+            word[6] = '\0';
+        }
+        else
+        {
+            strcpy(word, wordList[SimRandom(gs, 0, wordListCount - 1)]);
+        }
+
+        char letter = 'X';
+        for (int i = 0; word[i] && !blackHole; i++)
+        {
+            if (word[i] >= 'A' && word[i] <= 'Z') { letter = word[i]; break; }
+        }
+
+        for (int col = 0; col < wall->thickness; col++)
+        {
+            Block *block = &wall->blocks[row][col];
+            if (block->breakable) block->letter = blackHole ? '0' : letter;
+        }
+
+        AddWordTarget(gs, wall, row);
+    }
+
+    // Once per wall, here rather than on the next keystroke
+    WordMatcherLink(&gs->matcher);
+}
+
+// Pattern levels: the level's next wall, decoded straight from the mapped library.
+// False when it can't be read, so the caller falls back to a random wall.
+static bool StreamPatternWall(GameState *gs, Wall *wall, float x)
+{
+    char cells[WALL_ROWS][WALL_MAX_THICKNESS];
+    int  thickness = PatternDecodeWall(gs->tuning.patternLevel, gs->patternWall, cells);
+    if (!thickness) return false;
+
+    gs->patternWall++;
+    wall->thickness = thickness;
+    for (int row = 0; row < WALL_ROWS; row++)
+    {
+        for (int col = 0; col < thickness; col++)
+        {
+            Block *block     = &wall->blocks[row][col];
+            block->rect      = (Rectangle){ x + col * BLOCK_SIZE, row * BLOCK_SIZE, BLOCK_SIZE, BLOCK_SIZE };
+            block->letter    = cells[row][col];
+            block->breakable = (cells[row][col] != '\0');
+            block->active    = true;
+            block->fadeAlpha = 0.0f;
+        }
+    }
+    return true;
+}
+
+// Generates a wall of blocks at a given x position with certain thickness
+// (pattern levels bring their own thickness)
+void GenerateWall(GameState *gs, Wall *wall, float x, int thickness)
+{
+    TRACE_ZONE("GenerateWall");
+    if (gs->tuning.wordMode) RemoveWallWords(gs, wall);
+
+    wall->x         = x;
+    wall->spawnTime = gs->time;
+    wall->thickness = thickness;
+    wall->active    = true;
+    wall->scored    = false;
+
+    if (gs->tuning.patternLevel >= 0 && StreamPatternWall(gs, wall, x))
+    {
+        if (gs->tuning.wordMode) AssignWallWords(gs, wall);
+        return;
+    }
+
+    for (int row = 0; row < WALL_ROWS; row++)
+    {
+        bool hasBreakableBlock = false;
+
+        for (int col = 0; col < thickness; col++)
+        {
+            Block *block  = &wall->blocks[row][col];
+            block->rect   = (Rectangle){ x + col * BLOCK_SIZE, row * BLOCK_SIZE, BLOCK_SIZE, BLOCK_SIZE };
+            block->breakable = (SimRandom(gs, 1, 100) <= gs->tuning.breakablePercent);
+
+            if (block->breakable)
+            {
+                if (SimRandom(gs, 1, 100) <= gs->tuning.digitPercent)
+                {
+                    block->letter = '0' + SimRandom(gs, 0, 9);
+                }
+                else if (SimRandom(gs, 1, gs->tuning.blackHoleOdds) <= 1)
+                {
+                    block->letter = '0';
+                }
+                else
+                {
+                    block->letter = RandomBlockLetter(gs);
+                }
+                hasBreakableBlock = true;
+            }
+            else
+            {
+                block->letter = '\0';
+            }
+
+            block->active    = true;
+            block->fadeAlpha = 0.0f;
+        }
+
+        // Ensure at least one breakable block in each row
+        if (!hasBreakableBlock)
+        {
+            int col = SimRandom(gs, 0, thickness - 1);
+            Block *block = &wall->blocks[row][col];
+            block->breakable = true;
+
+            if (SimRandom(gs, 1, 100) <= gs->tuning.digitPercent)
+            {
+                block->letter = '0' + SimRandom(gs, 0, 9);
+            }
+            else
+            {
+                block->letter = RandomBlockLetter(gs);
+            }
+            block->active = true;
+        }
+    }
+
+    if (gs->tuning.wordMode) AssignWallWords(gs, wall);
+}
+
+// Resets the game state for a new round
+void GameReset(GameState *gs, uint32_t seed, uint32_t runId)
+{
+    GameResetTuned(gs, seed, runId, &defaultTuning);
+}
+
+// Same, with different balance knobs
+void GameResetTuned(GameState *gs, uint32_t seed, uint32_t runId, const GameTuning *tuning)
+{
+    memset(gs, 0, sizeof(*gs));
+
+    gs->tuning          = *tuning;
+    gs->runId           = runId;
+    gs->seed            = seed;
+    gs->rng             = seed ? seed : 0xDEADu;   // xorshift must not start at zero
+    gs->replayHash      = seed;
+    gs->playerPosition  = (Vector2){ 50, SCREEN_HEIGHT / 2 }; // Triangle center position
+    gs->invincibleCount = INVINCIBLE_CHARGES;
+    gs->wallSpeed       = tuning->wallSpeedBase;
+    gs->blackHolePos    = (Vector2){ SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 };
+    WordMatcherClear(&gs->matcher);
+
+    for (int i = 0; i < WALL_COUNT; i++)
+    {
+        GenerateWall(gs, &gs->walls[i], SCREEN_WIDTH + i * 300, 2);
+    }
+}
+
+// Pulls every block towards the black hole while it's open
+static void UpdateBlackHole(GameState *gs, float deltaTime)
+{
+    TRACE_ZONE("UpdateBlackHole");
+    ApplyScreenShake(gs, 2.0f);
+
+    // Swirling motion
+    float   angle = gs->time * 5.0f;
+    Vector2 swirl = { cosf(angle) * 5.0f, sinf(angle) * 5.0f };
+    float   pull  = 2.0f * deltaTime * 60;   // tuned as pixels per 60 Hz frame
+
+#ifdef SIM_SIMD
+    // Gather the live blocks and pull them four at a time
+    Block *live[WALL_COUNT * WALL_ROWS * WALL_MAX_THICKNESS];
+    int    liveCount = 0;
+    for (int i = 0; i < WALL_COUNT; i++)
+    {
+        for (int row = 0; row < WALL_ROWS; row++)
+        {
+            for (int col = 0; col < gs->walls[i].thickness; col++)
+            {
+                if (gs->walls[i].blocks[row][col].active) live[liveCount++] = &gs->walls[i].blocks[row][col];
+            }
+        }
+    }
+
+    for (int base = 0; base < liveCount; base += SIMD_LANES)
+    {
+        int lanes = (liveCount - base < SIMD_LANES) ? liveCount - base : SIMD_LANES;
+
+        // Spare lanes sit well away from the hole so they never divide by zero
+        SimdFloats bx, by;
+        for (int l = 0; l < SIMD_LANES; l++)
+        {
+            bx[l] = (l < lanes) ? live[base + l]->rect.x : gs->blackHolePos.x + 100;
+            by[l] = (l < lanes) ? live[base + l]->rect.y : gs->blackHolePos.y;
+        }
+
+        SimdFloats dx = gs->blackHolePos.x - bx;
+        SimdFloats dy = gs->blackHolePos.y - by;
+        SimdFloats squared = dx * dx + dy * dy;
+        SimdFloats distance;
+        for (int l = 0; l < SIMD_LANES; l++) distance[l] = sqrtf(squared[l]);   // f32x4.sqrt
+
+        SimdInts captured = distance < 10;
+        dx /= distance;
+        dy /= distance;
+        bx += (dx * 3.0f + swirl.x) * pull;
+        by += (dy * 3.0f + swirl.y) * pull;
+
+        for (int l = 0; l < lanes; l++)
+        {
+            Block *block = live[base + l];
+            if (captured[l]) block->active = false;
+            else             block->rect = (Rectangle){ bx[l], by[l], block->rect.width, block->rect.height };
+        }
+    }
+#else
+    for (int i = 0; i < WALL_COUNT; i++)
+    {
+        for (int row = 0; row < WALL_ROWS; row++)
+        {
+            for (int col = 0; col < gs->walls[i].thickness; col++)
+            {
+                Block *block = &gs->walls[i].blocks[row][col];
+                if (!block->active) continue;
+
+                Vector2 dir = { gs->blackHolePos.x - block->rect.x, gs->blackHolePos.y - block->rect.y };
+                float distance = sqrtf(dir.x * dir.x + dir.y * dir.y);
+                if (distance < 10)
+                {
+                    block->active = false;
+                    continue;
+                }
+
+                // Normalize direction
+                dir.x /= distance;
+                dir.y /= distance;
+
+                // Move block
+                block->rect.x += (dir.x * 3.0f + swirl.x) * pull;
+                block->rect.y += (dir.y * 3.0f + swirl.y) * pull;
+            }
+        }
+    }
+#endif
+
+    // Turn off Black Hole Mode after 1 second
+    gs->blackHoleTimeLeft -= deltaTime;
+    if (gs->blackHoleTimeLeft <= 0) gs->blackHoleActive = false;
+}
+
+// Ship hull in world space: the same rotated triangle DrawRotatedTriangle draws
+static void ShipHull(const GameState *gs, Vector2 hull[3])
+{
+    float radians = gs->rotation * DEG2RAD;
+    float cosR    = cosf(radians);
+    float sinR    = sinf(radians);
+
+    const Vector2 local[3] = { { PLAYER_SIZE * 1.5f, 0 }, { 0, -PLAYER_SIZE / 2 }, { 0, PLAYER_SIZE / 2 } };
+    for (int i = 0; i < 3; i++)
+    {
+        hull[i].x = gs->playerPosition.x + cosR * local[i].x - sinR * local[i].y;
+        hull[i].y = gs->playerPosition.y + sinR * local[i].x + cosR * local[i].y;
+    }
+}
+
+// Separating-axis test of the hull swept back along -sweep (where it was relative to the
+// blocks at the start of the step) against up to HULL_LANES rectangles at once. The swept
+// hull is the convex hull of both triangles, so its only edge directions are the triangle's
+// and the sweep's; with the two box axes that makes six candidate axes.
+static int SweptHullHits(const Vector2 hull[3], Vector2 sweep, const Rectangle *rects, int count, bool *hits)
+{
+    Vector2 axes[6] = {
+        { 1, 0 }, { 0, 1 },
+        { hull[0].y - hull[1].y, hull[1].x - hull[0].x },
+        { hull[1].y - hull[2].y, hull[2].x - hull[1].x },
+        { hull[2].y - hull[0].y, hull[0].x - hull[2].x },
+        { -sweep.y, sweep.x },
+    };
+    if (sweep.x == 0 && sweep.y == 0) axes[5] = axes[0];   // no motion, no extra edges
+
+    // Hull interval on each axis, widened by the sweep
+    float lo[6], hi[6];
+    for (int a = 0; a < 6; a++)
+    {
+        lo[a] = hi[a] = hull[0].x * axes[a].x + hull[0].y * axes[a].y;
+        for (int i = 1; i < 3; i++)
+        {
+            float d = hull[i].x * axes[a].x + hull[i].y * axes[a].y;
+            lo[a] = fminf(lo[a], d);
+            hi[a] = fmaxf(hi[a], d);
+        }
+        float s = sweep.x * axes[a].x + sweep.y * axes[a].y;
+        lo[a] -= fmaxf(s, 0);
+        hi[a] -= fminf(s, 0);
+    }
+
+    int hitCount = 0;
+    for (int base = 0; base < count; base += HULL_LANES)
+    {
+        // Structure-of-arrays load; spare lanes get an empty box far off screen
+        HullFloats cx, cy, hx, hy;
+        for (int l = 0; l < HULL_LANES; l++)
+        {
+            Rectangle r = (base + l < count) ? rects[base + l] : (Rectangle){ -1e6f, -1e6f, 0, 0 };
+            hx[l] = r.width / 2;
+            hy[l] = r.height / 2;
+            cx[l] = r.x + hx[l];
+            cy[l] = r.y + hy[l];
+        }
+
+        HullInts separated = { 0 };
+        for (int a = 0; a < 6; a++)
+        {
+            HullFloats center = cx * axes[a].x + cy * axes[a].y;
+            HullFloats radius = hx * fabsf(axes[a].x) + hy * fabsf(axes[a].y);
+            separated |= (center + radius <= lo[a]) | (center - radius >= hi[a]);
+        }
+
+        for (int l = 0; l < HULL_LANES && base + l < count; l++)
+        {
+            hits[base + l] = !separated[l];
+            hitCount += hits[base + l];
+        }
+    }
+    return hitCount;
+}
+
+// Marks the blocks of one wall the ship touched during this step. Only blocks in the band of
+// rows the swept hull spans go to the batched test; rows are checked by each block's own y
+// since a black hole leaves blocks wherever it pulled them. Only sets entries, the caller
+// clears hits.
+static void WallHullHits(const Wall *wall, const Vector2 hull[3], Vector2 sweep, bool hits[WALL_ROWS][WALL_MAX_THICKNESS])
+{
+    float left   = fminf(fminf(hull[0].x, hull[1].x), hull[2].x) - fmaxf(sweep.x, 0);
+    float right  = fmaxf(fmaxf(hull[0].x, hull[1].x), hull[2].x) - fminf(sweep.x, 0);
+    float top    = fminf(fminf(hull[0].y, hull[1].y), hull[2].y) - fmaxf(sweep.y, 0);
+    float bottom = fmaxf(fmaxf(hull[0].y, hull[1].y), hull[2].y) - fminf(sweep.y, 0);
+
+    // Most steps the wall is nowhere near the ship
+    if (wall->x >= right || wall->x + wall->thickness * BLOCK_SIZE <= left) return;
+
+    Rectangle rects[WALL_ROWS * WALL_MAX_THICKNESS];
+    uint8_t   cells[WALL_ROWS * WALL_MAX_THICKNESS][2];
+    int       count = 0;
+    for (int row = 0; row < WALL_ROWS; row++)
+    {
+        for (int col = 0; col < wall->thickness; col++)
+        {
+            const Block *block = &wall->blocks[row][col];
+            if (!block->active || block->rect.y >= bottom || block->rect.y + block->rect.height <= top) continue;
+
+            rects[count]    = block->rect;
+            cells[count][0] = row;
+            cells[count][1] = col;
+            count++;
+        }
+    }
+
+    bool laneHits[WALL_ROWS * WALL_MAX_THICKNESS];
+    if (!count || !SweptHullHits(hull, sweep, rects, count, laneHits)) return;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (laneHits[i]) hits[cells[i][0]][cells[i][1]] = true;
+    }
+}
+
+// A typed key that matched nothing: red flash, and a lockout after too many in a row
+static void PenaliseWrongKey(GameState *gs, char letter)
+{
+    gs->wrongKeyFlash = 0.5f;   // brief red flash every wrong press
+    gs->wrongKeyStreak++;
+    if (gs->wrongKeyStreak >= gs->tuning.wrongKeyStreakLimit)
+    {
+        gs->bufferOverflow   = gs->tuning.wrongKeyLockout;
+        gs->keyPressCooldown = gs->tuning.wrongKeyLockout;
+        gs->wrongKeyStreak   = 0;
+        gs->events |= SIM_EVENT_OVERFLOW;
+    }
+
+    float lockout = (gs->bufferOverflow > 0.0f) ? gs->bufferOverflow : 0.0f;
+    Emit(gs, TELE_WRONG_KEY, letter, gs->wrongKeyStreak, 0, 0, lockout);
+}
+
+// Word mode: destroys every breakable block of one completed row
+static void BreakWordRow(GameState *gs, Wall *wall, int row)
+{
+    bool blackHole = false;
+    for (int col = 0; col < wall->thickness; col++)
+    {
+        Block *block = &wall->blocks[row][col];
+        if (!block->active || !block->breakable) continue;
+
+        block->fadeAlpha = 1.0f; // Start fading
+        block->active    = false;
+        blackHole       |= (block->letter == '0');
+
+        SpawnParticles(gs, (Vector2){ block->rect.x + BLOCK_SIZE / 2, block->rect.y + BLOCK_SIZE / 2 }, GetBlockColor(block->letter));
+        Emit(gs, TELE_BLOCK_DESTROYED, block->letter, 0, block->rect.x, block->rect.y, (float)gs->time - wall->spawnTime);
+    }
+
+    if (blackHole)
+    {
+        gs->blackHoleActive   = true;
+        gs->blackHoleTimeLeft = BLACK_HOLE_DURATION;
+        gs->events |= SIM_EVENT_BLACK_HOLE;
+        Emit(gs, TELE_BLACK_HOLE, 0, 0, gs->blackHolePos.x, gs->blackHolePos.y, 0);
+    }
+
+    gs->events |= SIM_EVENT_BLOCK_DESTROY;
+    RemoveWordTarget(gs, wall, row);
+}
+
+// Word mode: feeds this step's keys to the matcher. Keys that went down in the same step are
+// fed in key order. A finished word breaks its row on the nearest wall that carries it; a key
+// that leaves nothing partly typed is a wrong key.
+static void UpdateWordTyping(GameState *gs, const GameInput *input)
+{
+    uint64_t typedKeys = input->pressed & ~(INPUT_WARP | InputKeyBit('W') | InputKeyBit('S'));
+    if (!typedKeys || gs->keyPressCooldown > 0.0f) return;
+
+    bool targetsLive = false;
+    for (int i = 0; i < WALL_COUNT; i++) targetsLive |= (gs->walls[i].wordLive != 0);
+    if (!targetsLive) return;
+
+    for (uint64_t keys = typedKeys; keys; keys &= keys - 1)
+    {
+        char     letter    = LowestKeyLetter(keys);
+        uint64_t completed = WordMatcherFeed(&gs->matcher, letter);
+
+        if (completed)
+        {
+            int nearest = -1;
+            for (uint64_t targets = completed; targets; targets &= targets - 1)
+            {
+                int target = __builtin_ctzll(targets);
+                if (nearest < 0 || gs->walls[target / WALL_ROWS].x < gs->walls[nearest / WALL_ROWS].x) nearest = target;
+            }
+
+            BreakWordRow(gs, &gs->walls[nearest / WALL_ROWS], nearest % WALL_ROWS);
+            gs->wrongKeyStreak = 0;
+        }
+        else if (gs->matcher.state == 0)
+        {
+            PenaliseWrongKey(gs, letter);
+            if (gs->keyPressCooldown > 0.0f) break;   // locked out
+        }
+    }
+}
+
+// Advances a live run by one step
+static void UpdatePlay(GameState *gs, const GameInput *input, float deltaTime)
+{
+    gs->playTime += deltaTime;
+    Vector2 startPosition = gs->playerPosition;
+
+    // Fold this step's input into the replay hash (splitmix64 finalizer), so the same score
+    // reached with different timing hashes differently
+    uint64_t h = gs->replayHash ^ input->pressed ^ ((uint64_t)input->up << 62) ^ ((uint64_t)input->down << 63);
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+    gs->replayHash = h ^ (h >> 31);
+
+    // Every typeable key that went down this step
+    for (uint64_t keys = input->pressed & (INPUT_WARP - 1); keys; keys &= keys - 1)
+    {
+        Emit(gs, TELE_KEY_PRESS, LowestKeyLetter(keys), 0, 0, 0, 0);
+    }
+
+    // Invincibility
+    if ((input->pressed & INPUT_WARP) && gs->invincibleCount > 0)
+    {
+        gs->events |= SIM_EVENT_WARP;
+        gs->invincibleCount--;
+
+        gs->playerInvincible   = true;
+        gs->invincibleTimeLeft = INVINCIBLE_DURATION;
+
+        // Store afterimage
+        gs->afterimages[gs->afterimageIndex] = (Afterimage){ gs->playerPosition, 1.0f };
+        gs->afterimageIndex = (gs->afterimageIndex + 1) % MAX_AFTERIMAGES;
+    }
+
+    if (gs->playerInvincible)
+    {
+        gs->invincibleTimeLeft -= deltaTime;
+        if (gs->invincibleTimeLeft <= 0) gs->playerInvincible = false;
+    }
+
+    for (int i = 0; i < MAX_AFTERIMAGES; i++)
+    {
+        if (gs->afterimages[i].alpha > 0.0f) gs->afterimages[i].alpha -= deltaTime;
+    }
+
+    // Player movement
+    if (input->up)   gs->playerPosition.y -= PLAYER_SPEED_Y * deltaTime;
+    if (input->down) gs->playerPosition.y += PLAYER_SPEED_Y * deltaTime;
+    gs->rotation = input->up ? -15 : input->down ? 15 : 0;
+
+    if (gs->blackHoleActive) UpdateBlackHole(gs, deltaTime);
+
+    // Keep player in screen bounds
+    if (gs->playerPosition.y < PLAYER_SIZE)                 gs->playerPosition.y = PLAYER_SIZE;
+    if (gs->playerPosition.y > SCREEN_HEIGHT - PLAYER_SIZE) gs->playerPosition.y = SCREEN_HEIGHT - PLAYER_SIZE;
+
+    // Update anti-spam timers
+    if (gs->keyPressCooldown > 0.0f) gs->keyPressCooldown -= deltaTime;
+    if (gs->wrongKeyFlash    > 0.0f) gs->wrongKeyFlash    -= deltaTime;
+    if (gs->bufferOverflow   > 0.0f) gs->bufferOverflow   -= deltaTime;
+
+    // Adjust wall speed/thickness by score
+    gs->wallSpeed = gs->tuning.wallSpeedBase + gs->score * gs->tuning.wallSpeedPerScore;
+    int newThickness = 2 + gs->score / gs->tuning.thicknessEvery;
+    if (newThickness > WALL_MAX_THICKNESS) newThickness = WALL_MAX_THICKNESS;
+
+    // Track whether a block was destroyed this step (for wrong-key detection)
+    bool blockDestroyedThisStep = false;
+    bool breakableBlockOnScreen = false; // any typeable block currently visible
+
+    // Ship motion relative to the walls this step (the black hole's pull is not swept)
+    Vector2 hull[3];
+    ShipHull(gs, hull);
+    Vector2 sweep = { gs->wallSpeed * deltaTime, gs->playerPosition.y - startPosition.y };
+
+    // Wall movement & collision
+    for (int i = 0; i < WALL_COUNT; i++)
+    {
+        Wall *wall = &gs->walls[i];
+        wall->x -= gs->wallSpeed * deltaTime;
+
+        if (wall->x + wall->thickness * BLOCK_SIZE < 0)
+        {
+            GenerateWall(gs, wall, SCREEN_WIDTH, newThickness);
+        }
+
+        if (wall->active)
+        {
+            for (int row = 0; row < WALL_ROWS; row++)
+            {
+                for (int col = 0; col < wall->thickness; col++) wall->blocks[row][col].rect.x = wall->x + col * BLOCK_SIZE;
+            }
+
+            // Collision: the hull swept over this step's motion relative to the wall
+            bool hits[WALL_ROWS][WALL_MAX_THICKNESS] = { 0 };
+            if (!gs->playerInvincible) WallHullHits(wall, hull, sweep, hits);
+
+            for (int row = 0; row < WALL_ROWS; row++)
+            {
+                for (int col = 0; col < wall->thickness; col++)
+                {
+                    Block *block = &wall->blocks[row][col];
+                    if (block->active)
+                    {
+                        if (hits[row][col])
+                        {
+                            if (!gs->gameOverTriggered)
+                            {
+                                gs->gameOverTriggered       = true;
+                                gs->playerCollisionPosition = gs->playerPosition;
+                                gs->deathCause              = block->breakable ? CAUSE_BLOCK : CAUSE_BARRIER;
+                                gs->events |= SIM_EVENT_CRASH;
+                                ApplyScreenShake(gs, 2.0f); // Stronger shake
+                                SpawnParticles(gs, gs->playerCollisionPosition, RED); // Explosion particles
+                                Emit(gs, TELE_DEATH, block->letter, gs->deathCause, gs->playerPosition.x, gs->playerPosition.y, 0);
+                            }
+                            gs->gameOver = true;
+                        }
+
+                        if (block->breakable)
+                            breakableBlockOnScreen = true;
+
+                        // Break block if correct key pressed
+                        if (block->breakable && !gs->tuning.wordMode && gs->keyPressCooldown <= 0.0f && (input->pressed & InputKeyBit(block->letter)))
+                        {
+                            blockDestroyedThisStep = true;
+                            block->fadeAlpha       = 1.0f; // Start fading
+                            block->active          = false;
+
+                            if (block->letter == '0')
+                            {
+                                gs->blackHoleActive   = true;
+                                gs->blackHoleTimeLeft = BLACK_HOLE_DURATION;
+                                gs->events |= SIM_EVENT_BLACK_HOLE;
+                                Emit(gs, TELE_BLACK_HOLE, 0, 0, gs->blackHolePos.x, gs->blackHolePos.y, 0);
+                            }
+                            SpawnParticles(gs,
+                                    (Vector2){
+                                    block->rect.x + BLOCK_SIZE / 2,
+                                    block->rect.y + BLOCK_SIZE / 2
+                                    },
+                                    GetBlockColor(block->letter)
+                                    );
+                            gs->events |= SIM_EVENT_BLOCK_DESTROY;
+                            Emit(gs, TELE_BLOCK_DESTROYED, block->letter, 0, block->rect.x, block->rect.y,
+                                    (float)gs->time - wall->spawnTime);
+                        }
+                    }
+
+                    // Fade destroyed blocks
+                    if (!block->active && block->fadeAlpha > 0.0f)
+                    {
+                        block->fadeAlpha -= deltaTime * 2.0f; // Fade speed
+                    }
+                }
+            }
+        }
+
+        // Score increment if player passes wall
+        if (!wall->scored && wall->x + wall->thickness * BLOCK_SIZE < gs->playerPosition.x)
+        {
+            gs->events |= ((gs->score + 1) % 5 == 0) ? SIM_EVENT_COMBO : SIM_EVENT_SCORE_UP;
+            gs->score++;
+            wall->scored = true;
+            if (gs->tuning.wordMode) RemoveWallWords(gs, wall);
+            Emit(gs, TELE_WALL_PASSED, 0, gs->score, wall->x, 0, wall->thickness);
+        }
+    }
+
+    if (gs->tuning.wordMode)
+    {
+        UpdateWordTyping(gs, input);
+        return;
+    }
+
+    // Start cooldown after any successful key press (once per press, not per block)
+    if (blockDestroyedThisStep)
+    {
+        gs->keyPressCooldown = gs->tuning.keyCooldown;
+        gs->wrongKeyStreak   = 0;
+    }
+
+    // Wrong-key detection: only penalise when there are blocks on screen to type
+    uint64_t typedKeys = input->pressed & ~(INPUT_WARP | InputKeyBit('W') | InputKeyBit('S'));
+    if (!blockDestroyedThisStep && gs->keyPressCooldown <= 0.0f && breakableBlockOnScreen && typedKeys)
+    {
+        PenaliseWrongKey(gs, LowestKeyLetter(typedKeys));
+    }
+}
+
+// Advances the simulation by deltaTime seconds
+void GameStep(GameState *gs, const GameInput *input, float deltaTime)
+{
+    gs->events = 0;
+
+    if (gs->time == 0.0) Emit(gs, TELE_RUN_START, 0, 0, gs->seed >> 16, gs->seed & 0xFFFF, 0);
+
+    if (!gs->gameOver) UpdatePlay(gs, input, deltaTime);
+
+    // The crash explosion and shake keep playing out on the game over screen
+    UpdateParticles(gs, deltaTime);
+    UpdateScreenShake(gs, deltaTime);
+
+    gs->time += deltaTime;
+}
+
+// Starts a race: both players get the same walls
+void VersusReset(VersusState *vs, uint32_t seed)
+{
+    vs->frame = 0;
+    for (int i = 0; i < VERSUS_PLAYERS; i++)
+    {
+        GameReset(&vs->players[i], seed, 1);
+        vs->players[i].telemetryOff = true;
+    }
+}
+
+// Steps both players, then applies what each did to the other:
+// a black hole jams the opponent's keys, a buffer overflow hands the opponent a point
+void VersusStep(VersusState *vs, const GameInput inputs[VERSUS_PLAYERS], float deltaTime)
+{
+    for (int i = 0; i < VERSUS_PLAYERS; i++) GameStep(&vs->players[i], &inputs[i], deltaTime);
+
+    for (int i = 0; i < VERSUS_PLAYERS; i++)
+    {
+        uint32_t   events   = vs->players[i].events;
+        GameState *opponent = &vs->players[1 - i];
+        if (opponent->gameOver) continue;
+
+        if (events & SIM_EVENT_BLACK_HOLE)
+        {
+            if (opponent->keyPressCooldown < VERSUS_JAM_TIME) opponent->keyPressCooldown = VERSUS_JAM_TIME;
+            opponent->wrongKeyFlash = WRONG_KEY_FLASH_DUR;
+            opponent->events |= SIM_EVENT_JAMMED;
+            ApplyScreenShake(opponent, 1.0f);
+        }
+        if (events & SIM_EVENT_OVERFLOW)
+        {
+            opponent->score++;
+            opponent->events |= SIM_EVENT_SCORE_UP;
+        }
+    }
+
+    vs->frame++;
+}
+
+static float Lerp(float a, float b, float t)
+{
+    return a + (b - a) * t;
+}
+
+// Copies everything but the word matcher outside word mode
+void GameCopy(GameState *dst, const GameState *src)
+{
+    memcpy(dst, src, src->tuning.wordMode ? sizeof(GameState) : offsetof(GameState, matcher));
+}
+
+void VersusCopy(VersusState *dst, const VersusState *src)
+{
+    dst->frame = src->frame;
+    for (int i = 0; i < VERSUS_PLAYERS; i++) GameCopy(&dst->players[i], &src->players[i]);
+}
+
+// Blends moving things between two consecutive states for display; the rest comes from current
+void GameInterpolate(GameState *out, const GameState *previous, const GameState *current, float alpha)
+{
+    GameCopy(out, current);
+    if (previous->runId != current->runId) return;
+
+    if (alpha < 0.0f) alpha = 0.0f;
+    if (alpha > 1.0f) alpha = 1.0f;
+
+    out->playerPosition.x = Lerp(previous->playerPosition.x, current->playerPosition.x, alpha);
+    out->playerPosition.y = Lerp(previous->playerPosition.y, current->playerPosition.y, alpha);
+
+    for (int i = 0; i < WALL_COUNT; i++)
+    {
+        const Wall *from = &previous->walls[i];
+        const Wall *to   = &current->walls[i];
+        Wall       *wall = &out->walls[i];
+
+        // Walls only move left; a jump to the right means it was regenerated
+        if (to->x > from->x || to->thickness != from->thickness) continue;
+
+        wall->x = Lerp(from->x, to->x, alpha);
+        for (int row = 0; row < WALL_ROWS; row++)
+        {
+            for (int col = 0; col < to->thickness; col++)
+            {
+                wall->blocks[row][col].rect.x = Lerp(from->blocks[row][col].rect.x, to->blocks[row][col].rect.x, alpha);
+                wall->blocks[row][col].rect.y = Lerp(from->blocks[row][col].rect.y, to->blocks[row][col].rect.y, alpha);
+            }
+        }
+    }
+
+    for (int i = 0; i < MAX_PARTICLES; i++)
+    {
+        const Particle *from = &previous->particles[i];
+        const Particle *to   = &current->particles[i];
+
+        // A slot whose lifetime went up was respawned somewhere else
+        if (to->lifetime <= 0 || to->lifetime > from->lifetime) continue;
+
+        out->particles[i].position.x = Lerp(from->position.x, to->position.x, alpha);
+        out->particles[i].position.y = Lerp(from->position.y, to->position.y, alpha);
+        out->particles[i].lifetime   = Lerp(from->lifetime, to->lifetime, alpha);
+    }
+}
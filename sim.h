@@ -0,0 +1,225 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - gameplay simulation
+ *
+ * Everything that decides the outcome of a run lives in GameState and is advanced only by
+ * GameStep. The state is flat (no pointers) so it can be copied as a snapshot, and the
+ * step never touches the window, audio or raylib's global RNG, so it can run on any thread.
+*******************************************************************************************/
+
+#ifndef SIM_H
+#define SIM_H
+
+#include "raylib.h"     // Vector2, Rectangle and Color types only
+#include "telemetry.h"  // TelemetryRecord
+#include "words.h"      // WordMatcher
+#include <stdbool.h>
+#include <stdint.h>
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define SCREEN_WIDTH   800
+#define SCREEN_HEIGHT  600
+#define BLOCK_SIZE     40
+#define WALL_COUNT     3
+#define WALL_ROWS      (SCREEN_HEIGHT / BLOCK_SIZE)
+#define WALL_MAX_THICKNESS 5
+
+// Color Definitions
+#define BACKGROUND BLACK
+#define CYAN          (Color){0, 255, 255, 255}
+#define DARKGOLD      (Color){184, 134, 11, 255}
+#define DARKORANGE    (Color){255, 140, 0, 255}
+#define LIGHTGREEN    (Color){144, 238, 144, 255}
+#define DARKRED       (Color){139, 0, 0, 255}
+#define AQUA          (Color){0, 255, 255, 255}
+#define TAN           (Color){210, 180, 140, 255}
+#define PLUM          (Color){221, 160, 221, 255}
+#define TEAL          (Color){0, 128, 128, 255}
+#define SALMON        (Color){250, 128, 114, 255}
+
+// Particle/Afterimage Limits
+#define MAX_PARTICLES    300
+#define MAX_AFTERIMAGES  10
+
+// Player
+#define PLAYER_SIZE          20.0f   // Size of the spaceship triangle
+#define PLAYER_SPEED_Y       200.0f
+#define INVINCIBLE_CHARGES   2
+#define INVINCIBLE_DURATION  5.0f
+#define BLACK_HOLE_DURATION  1.0f
+
+// Anti-spam settings
+#define KEY_COOLDOWN_TIME   0.15f   // seconds between any block-breaking key presses
+#define WRONG_KEY_FLASH_DUR 0.4f    // red flash duration on wrong key
+#define WRONG_KEY_LOCKOUT   0.6f    // input lockout duration for wrong key press
+
+// Fixed simulation rate
+#define SIM_TICK_RATE   240
+#define SIM_DT          (1.0f / SIM_TICK_RATE)
+
+// Input: one pressed-bit per typeable key (A-Z then 0-9), plus the invincibility key
+#define INPUT_KEY_COUNT 36
+#define INPUT_WARP      (1ULL << INPUT_KEY_COUNT)
+
+// Events raised by a step (sounds, session bookkeeping)
+#define SIM_EVENT_CRASH         (1u << 0)
+#define SIM_EVENT_BLACK_HOLE    (1u << 1)
+#define SIM_EVENT_BLOCK_DESTROY (1u << 2)
+#define SIM_EVENT_WARP          (1u << 3)
+#define SIM_EVENT_SCORE_UP      (1u << 4)
+#define SIM_EVENT_COMBO         (1u << 5)
+#define SIM_EVENT_OVERFLOW      (1u << 6)   // three wrong keys in a row
+#define SIM_EVENT_JAMMED        (1u << 7)   // versus: hit by the opponent's black hole
+
+// Versus mode
+#define VERSUS_PLAYERS          2
+#define VERSUS_JAM_TIME         0.5f    // opponent's key lockout when you open a black hole
+
+/*******************************************************************************************
+*  DATA STRUCTURES
+*******************************************************************************************/
+
+typedef struct {
+    Rectangle rect;
+    char letter;
+    bool active;
+    bool breakable;
+    float fadeAlpha;
+} Block;
+
+typedef struct {
+    Block blocks[WALL_ROWS][WALL_MAX_THICKNESS];
+    float x;
+    float spawnTime;   // GameState.time when generated (for reaction times)
+    int thickness;
+    bool active;
+    bool scored;
+    char words[WALL_ROWS][WORD_MAX_LENGTH + 1];   // word mode: what each row wants typed
+    uint16_t wordLive;                            // word mode: rows whose word is still a target
+} Wall;
+
+typedef struct {
+    Vector2 position;
+    float alpha;
+} Afterimage;
+
+typedef struct {
+    Vector2 position;
+    Vector2 velocity;
+    float   lifetime;
+    float   size;  // Random particle size
+    Color   color;
+} Particle;
+
+// Balance knobs, per run so tools can try variations side by side
+typedef struct {
+    int   breakablePercent;         // chance a block has a letter
+    int   digitPercent;             // chance a letter block shows a digit instead
+    int   blackHoleOdds;            // 1 in N of the remaining letter blocks is a black hole
+    float wallSpeedBase;            // pixels per second at score 0
+    float wallSpeedPerScore;
+    int   thicknessEvery;           // walls grow a column every N points
+    float keyCooldown;              // KEY_COOLDOWN_TIME
+    float wrongKeyLockout;          // WRONG_KEY_LOCKOUT
+    int   wrongKeyStreakLimit;      // wrong presses in a row before BUFFER OVERFLOW
+    bool  wordMode;                 // rows carry whole words instead of single letters (words.h)
+    int   patternLevel;             // -1: random walls, else a level of the pattern library (patterns.h)
+} GameTuning;
+
+// Input for one step: keys held right now, and keys pressed since the previous step
+typedef struct {
+    uint64_t pressed;   // INPUT_KEY_COUNT key bits | INPUT_WARP
+    bool     up;
+    bool     down;
+} GameInput;
+
+typedef struct {
+    uint32_t runId;                 // bumped on every reset, lets readers spot stale snapshots
+    uint32_t seed;                  // what the run was reset with
+    uint32_t rng;                   // per-run random state
+    double   time;                  // simulated seconds since reset
+    float    playTime;              // simulated seconds alive
+    uint32_t events;                // SIM_EVENT_* raised by the last step
+    uint64_t replayHash;            // running hash of every played step's input (leaderboard digest)
+    GameTuning tuning;
+    bool     telemetryOff;          // don't report this run (versus, re-simulation)
+
+    // Player
+    Vector2 playerPosition;
+    float   rotation;               // ship tilt from held movement keys
+    int     invincibleCount;
+    bool    playerInvincible;
+    float   invincibleTimeLeft;
+
+    // Black hole
+    bool    blackHoleActive;
+    float   blackHoleTimeLeft;
+    Vector2 blackHolePos;
+
+    // Anti-spam state
+    float   keyPressCooldown;       // min time between block-breaking key presses
+    float   wrongKeyFlash;          // brief red overlay timer (every wrong press)
+    float   bufferOverflow;         // BUFFER OVERFLOW message + lockout timer
+    int     wrongKeyStreak;         // consecutive wrong presses; resets on correct press
+
+    // Progress
+    int     score;
+    float   wallSpeed;
+    bool    gameOver;
+    bool    gameOverTriggered;      // Ensures effect plays only once
+    int     deathCause;             // DeathCause from save.h
+    Vector2 playerCollisionPosition;
+    float   screenShake;            // Tracks screen shake intensity
+
+    Wall       walls[WALL_COUNT];
+    Afterimage afterimages[MAX_AFTERIMAGES];
+    int        afterimageIndex;
+    Particle   particles[MAX_PARTICLES];
+    int        particleIndex;
+
+    uint32_t    patternWall;        // pattern levels: next wall of the level to stream in
+
+    // Word mode only, and about half the state: kept last so GameCopy can skip it otherwise
+    WordMatcher matcher;            // live row words
+} GameState;
+
+// Two-player race on the same seed. Flat, so rollback can snapshot it with VersusCopy.
+typedef struct {
+    uint32_t  frame;                // ticks stepped since reset
+    GameState players[VERSUS_PLAYERS];
+} VersusState;
+
+/*******************************************************************************************
+*  GLOBAL VARIABLES
+*******************************************************************************************/
+
+// Receives telemetry events from GameStep/GameReset when set (called on the stepping thread)
+extern void (*simTelemetrySink)(const TelemetryRecord *record);
+
+extern const GameTuning defaultTuning;
+
+/*******************************************************************************************
+*  FUNCTION DECLARATIONS
+*******************************************************************************************/
+
+Color    GetBlockColor(char letter);
+uint64_t InputKeyBit(char letter);   // 0 for letters that aren't typeable
+
+int      SimRandom(GameState *gs, int min, int max);
+void     ApplyScreenShake(GameState *gs, float intensity);
+void     SpawnParticles(GameState *gs, Vector2 position, Color color);
+void     GenerateWall(GameState *gs, Wall *wall, float x, int thickness);
+
+void     GameReset(GameState *gs, uint32_t seed, uint32_t runId);
+void     GameResetTuned(GameState *gs, uint32_t seed, uint32_t runId, const GameTuning *tuning);
+void     GameStep(GameState *gs, const GameInput *input, float deltaTime);
+void     GameCopy(GameState *dst, const GameState *src);      // leaves out the matcher outside word mode
+void     GameInterpolate(GameState *out, const GameState *previous, const GameState *current, float alpha);
+
+void     VersusReset(VersusState *vs, uint32_t seed);
+void     VersusStep(VersusState *vs, const GameInput inputs[VERSUS_PLAYERS], float deltaTime);
+void     VersusCopy(VersusState *dst, const VersusState *src);
+
+#endif // SIM_H
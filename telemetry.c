@@ -0,0 +1,231 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - gameplay telemetry
+*******************************************************************************************/
+
+#include "raylib.h"
+#include "telemetry.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#ifndef PLATFORM_WEB
+    #include <pthread.h>
+#endif
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define TELEMETRY_RING_SIZE    4096               // records, power of two
+#define TELEMETRY_BATCH_MAX    1024               // records compressed together
+#define TELEMETRY_FLUSH_TIME   2.0                // seconds before a partial batch is written
+#define TELEMETRY_POLL_TIME    0.1                // writer wake-up interval
+#define TELEMETRY_FILE_LIMIT   (4 * 1024 * 1024)  // bytes before the log rotates
+#define TELEMETRY_FILE_KEEP    4                  // rotated files kept, including the live one
+
+/*******************************************************************************************
+*  GLOBAL VARIABLES
+*******************************************************************************************/
+
+// SPSC ring: the producer only advances ringHead, the writer only advances ringTail
+static TelemetryRecord ring[TELEMETRY_RING_SIZE];
+static atomic_size_t   ringHead;
+static atomic_size_t   ringTail;
+static atomic_uint     droppedRecords;
+
+#ifndef PLATFORM_WEB
+static char            logDir[400];
+static pthread_t       writerThread;
+static atomic_bool     writerRunning;
+
+// Writer-thread only
+static TelemetryRecord batch[TELEMETRY_BATCH_MAX];
+static int             batchCount;
+static FILE           *logFile;
+static long            logSize;
+#endif
+
+/*******************************************************************************************
+*  FUNCTION DEFINITIONS
+*******************************************************************************************/
+
+void TelemetryPush(const TelemetryRecord *record)
+{
+    size_t head = atomic_load_explicit(&ringHead, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&ringTail, memory_order_acquire);
+
+    if (head - tail >= TELEMETRY_RING_SIZE)
+    {
+        atomic_fetch_add_explicit(&droppedRecords, 1, memory_order_relaxed);
+        return;
+    }
+
+    ring[head & (TELEMETRY_RING_SIZE - 1)] = *record;
+    atomic_store_explicit(&ringHead, head + 1, memory_order_release);
+}
+
+#ifndef PLATFORM_WEB
+
+static double NowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void SleepSeconds(double seconds)
+{
+    struct timespec ts = { (time_t)seconds, (long)((seconds - (time_t)seconds) * 1e9) };
+    nanosleep(&ts, NULL);
+}
+
+static void LogFileName(char *out, size_t size, int index)
+{
+    if (index == 0) snprintf(out, size, "%s/%s.bin", logDir, TELEMETRY_FILE_NAME);
+    else            snprintf(out, size, "%s/%s.%d.bin", logDir, TELEMETRY_FILE_NAME, index);
+}
+
+// Shifts telemetry.bin -> telemetry.1.bin -> ... and drops the oldest
+static void RotateLog(void)
+{
+    char from[512], to[512];
+
+    if (logFile) fclose(logFile);
+
+    for (int i = TELEMETRY_FILE_KEEP - 1; i > 0; i--)
+    {
+        LogFileName(from, sizeof(from), i - 1);
+        LogFileName(to, sizeof(to), i);
+        rename(from, to);
+    }
+
+    LogFileName(from, sizeof(from), 0);
+    logFile = fopen(from, "ab");
+    logSize = 0;
+    if (!logFile) TraceLog(LOG_WARNING, "TELEMETRY: Can't open %s", from);
+}
+
+// Compresses the pending batch and appends it to the log
+static void FlushBatch(void)
+{
+    if (batchCount == 0) return;
+
+    int compressedSize = 0;
+    unsigned char *compressed = CompressData((const unsigned char *)batch, batchCount * sizeof(TelemetryRecord), &compressedSize);
+
+    if (compressed && logFile)
+    {
+        TelemetryBatchHeader header = { TELEMETRY_MAGIC, batchCount, compressedSize };
+        fwrite(&header, sizeof(header), 1, logFile);
+        fwrite(compressed, 1, compressedSize, logFile);
+        fflush(logFile);
+
+        logSize += sizeof(header) + compressedSize;
+        if (logSize >= TELEMETRY_FILE_LIMIT) RotateLog();
+    }
+
+    MemFree(compressed);
+    batchCount = 0;
+}
+
+// Moves everything currently in the ring into the batch, flushing whenever it fills
+static void DrainRing(void)
+{
+    size_t tail = atomic_load_explicit(&ringTail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&ringHead, memory_order_acquire);
+
+    while (tail != head)
+    {
+        batch[batchCount++] = ring[tail & (TELEMETRY_RING_SIZE - 1)];
+        tail++;
+        atomic_store_explicit(&ringTail, tail, memory_order_release);
+
+        if (batchCount == TELEMETRY_BATCH_MAX) FlushBatch();
+    }
+}
+
+// Writer thread: wakes periodically, batches, compresses and writes
+static void *WriterMain(void *arg)
+{
+    (void)arg;
+    double lastFlush = NowSeconds();
+
+    while (atomic_load(&writerRunning))
+    {
+        SleepSeconds(TELEMETRY_POLL_TIME);
+        DrainRing();
+
+        if (batchCount > 0 && NowSeconds() - lastFlush >= TELEMETRY_FLUSH_TIME)
+        {
+            FlushBatch();
+            lastFlush = NowSeconds();
+        }
+    }
+
+    DrainRing();
+    FlushBatch();
+    return NULL;
+}
+
+bool TelemetryOpen(const char *dir)
+{
+    const char *enabled = getenv("DEADTYPE_TELEMETRY");
+    if (!enabled || !*enabled || !strcmp(enabled, "0")) return false;
+
+    snprintf(logDir, sizeof(logDir), "%s", dir);
+
+    char path[512];
+    LogFileName(path, sizeof(path), 0);
+    logFile = fopen(path, "ab");
+    if (!logFile)
+    {
+        TraceLog(LOG_WARNING, "TELEMETRY: Can't open %s", path);
+        return false;
+    }
+    fseek(logFile, 0, SEEK_END);
+    logSize = ftell(logFile);
+
+    atomic_store(&writerRunning, true);
+    if (pthread_create(&writerThread, NULL, WriterMain, NULL) != 0)
+    {
+        atomic_store(&writerRunning, false);
+        fclose(logFile);
+        logFile = NULL;
+        TraceLog(LOG_WARNING, "TELEMETRY: Writer thread failed to start");
+        return false;
+    }
+
+    TraceLog(LOG_INFO, "TELEMETRY: Logging to %s", path);
+    return true;
+}
+
+void TelemetryClose(void)
+{
+    if (!atomic_load(&writerRunning)) return;
+
+    atomic_store(&writerRunning, false);
+    pthread_join(writerThread, NULL);
+
+    if (logFile) fclose(logFile);
+    logFile = NULL;
+
+    unsigned int dropped = atomic_load(&droppedRecords);
+    if (dropped) TraceLog(LOG_WARNING, "TELEMETRY: %u records dropped (ring full)", dropped);
+}
+
+#else
+
+// Web builds don't keep telemetry
+bool TelemetryOpen(const char *dir)
+{
+    (void)dir;
+    return false;
+}
+
+void TelemetryClose(void)
+{
+}
+
+#endif
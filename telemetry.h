@@ -0,0 +1,67 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - gameplay telemetry
+ *
+ * Fixed-size event records for tuning. The thread running the simulation is the only
+ * producer: it drops records into a lock-free single-producer ring and returns. A
+ * background thread drains the ring, compresses batches and appends them to a rotating
+ * binary log (tools/telemetry_dump converts it to CSV or JSON).
+ *
+ * Opt-in: nothing is recorded unless DEADTYPE_TELEMETRY is set.
+*******************************************************************************************/
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define TELEMETRY_MAGIC      0x4C544454u   // "DTTL", starts every batch in the log
+#define TELEMETRY_FILE_NAME  "telemetry"   // telemetry.bin, rotated to telemetry.1.bin ...
+
+typedef enum {
+    TELE_RUN_START = 0,     // x/y: high/low 16 bits of the seed
+    TELE_KEY_PRESS,         // key
+    TELE_BLOCK_DESTROYED,   // key, x/y of the block, value: reaction time since the wall spawned
+    TELE_WRONG_KEY,         // key, count: streak, value: lockout seconds (0 unless overflowed)
+    TELE_WALL_PASSED,       // count: new score, value: wall thickness
+    TELE_BLACK_HOLE,        // x/y of the hole
+    TELE_DEATH,             // x/y of the crash, count: DeathCause
+    TELE_TYPE_COUNT
+} TelemetryType;
+
+/*******************************************************************************************
+*  DATA STRUCTURES
+*******************************************************************************************/
+
+// One event. Written verbatim (inside compressed batches), so keep it fixed-size.
+typedef struct {
+    uint32_t runId;
+    float    time;      // simulated seconds since the run started
+    uint8_t  type;      // TelemetryType
+    char     key;       // letter involved, 0 if none
+    uint16_t count;
+    float    x;
+    float    y;
+    float    value;
+} TelemetryRecord;
+
+// Header in front of every compressed batch
+typedef struct {
+    uint32_t magic;
+    uint32_t count;            // records in the batch
+    uint32_t compressedSize;   // bytes of deflate data that follow
+} TelemetryBatchHeader;
+
+/*******************************************************************************************
+*  FUNCTION DECLARATIONS
+*******************************************************************************************/
+
+bool TelemetryOpen(const char *dir);                  // Starts the writer; false when disabled
+void TelemetryPush(const TelemetryRecord *record);    // Producer side, never blocks (drops when full)
+void TelemetryClose(void);                            // Drains the ring and stops the writer
+
+#endif // TELEMETRY_H
@@ -0,0 +1,428 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - headless batch simulator
+ *
+ * Usage: batchsim [-n games] [-j threads] [-s seed] [-t seconds]
+ *                 [--reaction seconds] [--error rate] [--set knob=value ...]
+ *                 [--level n [--patterns walls.dtw]]
+ *
+ * Plays N seeded games with a simple bot on every core and prints histograms of score,
+ * survival time and cause of death. Knobs are the GameTuning fields, e.g.
+ *   batchsim -n 20000 --set wallSpeedPerScore=3 --set wrongKeyLockout=0.4
+ * Game i always uses the same seed, so runs are reproducible regardless of thread count.
+ * --level plays a curated level of the pattern library instead of random walls.
+*******************************************************************************************/
+
+#include "../sim.h"
+#include "../save.h"
+#include "../patterns.h"
+#include "../trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define MAX_THREADS   256
+#define SCORE_BINS    64        // one point per bin, last bin collects the rest
+#define TIME_BIN_SIZE 10.0f     // seconds per survival time bin
+#define TIME_BINS     64
+#define CAUSE_COUNT   4         // DeathCause values; CAUSE_NONE means the time limit was hit
+
+/*******************************************************************************************
+*  DATA STRUCTURES
+*******************************************************************************************/
+
+// How good the bot is
+typedef struct {
+    float reaction;     // seconds between key presses
+    float errorRate;    // chance a press hits a random wrong key
+} BotSkill;
+
+typedef struct {
+    uint32_t rng;
+    double   nextPress;   // sim time the bot may press again
+} Bot;
+
+// Aggregated results (one per worker, merged at the end)
+typedef struct {
+    uint64_t games;
+    uint64_t ticks;
+    double   scoreSum;
+    double   timeSum;
+    int      maxScore;
+    uint32_t scoreHist[SCORE_BINS];
+    uint32_t timeHist[TIME_BINS];
+    uint32_t causes[CAUSE_COUNT];
+} Stats;
+
+// Each worker owns a range of game indices; idle workers steal the upper half of another's
+typedef struct {
+    _Alignas(64) atomic_uint_fast64_t range;   // end << 32 | begin
+    pthread_t thread;
+    int       index;
+    Stats     stats;
+} Worker;
+
+/*******************************************************************************************
+*  GLOBAL VARIABLES
+*******************************************************************************************/
+
+static Worker     workers[MAX_THREADS];
+static int        workerCount = 0;
+static uint32_t   baseSeed    = 1;
+static float      maxSeconds  = 600.0f;
+static BotSkill   skill       = { 0.25f, 0.05f };
+static GameTuning tuning;
+
+// --set knobs
+static const struct {
+    const char *name;
+    size_t      offset;
+    bool        isFloat;
+} knobs[] = {
+    { "breakablePercent",    offsetof(GameTuning, breakablePercent),    false },
+    { "digitPercent",        offsetof(GameTuning, digitPercent),        false },
+    { "blackHoleOdds",       offsetof(GameTuning, blackHoleOdds),       false },
+    { "wallSpeedBase",       offsetof(GameTuning, wallSpeedBase),       true  },
+    { "wallSpeedPerScore",   offsetof(GameTuning, wallSpeedPerScore),   true  },
+    { "thicknessEvery",      offsetof(GameTuning, thicknessEvery),      false },
+    { "keyCooldown",         offsetof(GameTuning, keyCooldown),         true  },
+    { "wrongKeyLockout",     offsetof(GameTuning, wrongKeyLockout),     true  },
+    { "wrongKeyStreakLimit", offsetof(GameTuning, wrongKeyStreakLimit), false },
+};
+
+/*******************************************************************************************
+*  FUNCTION DEFINITIONS
+*******************************************************************************************/
+
+static uint32_t BotRandom(Bot *bot)
+{
+    uint32_t x = bot->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return bot->rng = x;
+}
+
+// The wall the ship has to get through next
+static const Wall *NextWall(const GameState *gs)
+{
+    const Wall *next = NULL;
+
+    for (int i = 0; i < WALL_COUNT; i++)
+    {
+        const Wall *wall = &gs->walls[i];
+        if (!wall->active || wall->x + wall->thickness * BLOCK_SIZE < gs->playerPosition.x) continue;
+        if (!next || wall->x < next->x) next = wall;
+    }
+    return next;
+}
+
+// Steers to the nearest row it can type its way through and types the blocks in it
+static GameInput BotThink(Bot *bot, const GameState *gs)
+{
+    GameInput input = { 0 };
+    const Wall *wall = NextWall(gs);
+    if (!wall) return input;
+
+    int playerRow = (int)(gs->playerPosition.y / BLOCK_SIZE);
+    int bestRow   = -1;
+
+    for (int row = 0; row < WALL_ROWS; row++)
+    {
+        bool clearable = true;
+        for (int col = 0; col < wall->thickness; col++)
+        {
+            const Block *block = &wall->blocks[row][col];
+            if (block->active && !block->breakable) clearable = false;
+        }
+        if (clearable && (bestRow < 0 || abs(row - playerRow) < abs(bestRow - playerRow))) bestRow = row;
+    }
+
+    float distance = wall->x - gs->playerPosition.x;
+    bool  panic    = distance < PLAYER_SIZE * 2 && !gs->playerInvincible && gs->invincibleCount > 0;
+
+    if (bestRow < 0)
+    {
+        if (panic) input.pressed |= INPUT_WARP;
+        return input;
+    }
+
+    float targetY = bestRow * BLOCK_SIZE + BLOCK_SIZE / 2;
+    input.up   = gs->playerPosition.y > targetY + 4;
+    input.down = gs->playerPosition.y < targetY - 4;
+
+    // Type the leftmost block still standing in the row
+    const Block *block = NULL;
+    for (int col = 0; col < wall->thickness && !block; col++)
+    {
+        if (wall->blocks[bestRow][col].active) block = &wall->blocks[bestRow][col];
+    }
+
+    if (block && wall->x < SCREEN_WIDTH && gs->keyPressCooldown <= 0.0f && gs->time >= bot->nextPress)
+    {
+        char letter = block->letter;
+        if ((BotRandom(bot) % 1000) < skill.errorRate * 1000) letter = 'A' + BotRandom(bot) % 26;
+
+        input.pressed |= InputKeyBit(letter);
+        bot->nextPress = gs->time + skill.reaction * (0.75f + (BotRandom(bot) % 500) / 1000.0f);
+    }
+
+    if (block && panic && playerRow == bestRow) input.pressed |= INPUT_WARP;
+
+    return input;
+}
+
+// Plays one game to the end (or the time limit) and records it
+static void PlayGame(uint32_t index, Stats *stats)
+{
+    static _Thread_local GameState gs;
+
+    uint32_t seed = (baseSeed + index) * 0x9E3779B9u;
+    Bot      bot  = { seed ^ 0xB07B07u, 0.0 };
+    uint64_t ticks = 0;
+
+    GameResetTuned(&gs, seed, index + 1, &tuning);
+    gs.telemetryOff = true;
+
+    while (!gs.gameOver && gs.playTime < maxSeconds)
+    {
+        GameInput input = BotThink(&bot, &gs);
+        GameStep(&gs, &input, SIM_DT);
+        ticks++;
+    }
+
+    int score = gs.score;
+    int cause = gs.gameOver ? gs.deathCause : CAUSE_NONE;
+    int bin   = (int)(gs.playTime / TIME_BIN_SIZE);
+
+    stats->games++;
+    stats->ticks    += ticks;
+    stats->scoreSum += score;
+    stats->timeSum  += gs.playTime;
+    if (score > stats->maxScore) stats->maxScore = score;
+    stats->scoreHist[(score < SCORE_BINS) ? score : SCORE_BINS - 1]++;
+    stats->timeHist[(bin < TIME_BINS) ? bin : TIME_BINS - 1]++;
+    stats->causes[(cause >= 0 && cause < CAUSE_COUNT) ? cause : CAUSE_NONE]++;
+}
+
+static uint64_t PackRange(uint32_t begin, uint32_t end)
+{
+    return ((uint64_t)end << 32) | begin;
+}
+
+// Pops the next game from the front of the worker's own range
+static bool TakeOwn(Worker *worker, uint32_t *game)
+{
+    uint64_t range = atomic_load(&worker->range);
+
+    for (;;)
+    {
+        uint32_t begin = (uint32_t)range, end = (uint32_t)(range >> 32);
+        if (begin >= end) return false;
+
+        if (atomic_compare_exchange_weak(&worker->range, &range, PackRange(begin + 1, end)))
+        {
+            *game = begin;
+            return true;
+        }
+    }
+}
+
+// Moves the upper half of some other worker's range into ours
+static bool Steal(Worker *thief)
+{
+    for (int offset = 1; offset < workerCount; offset++)
+    {
+        Worker  *victim = &workers[(thief->index + offset) % workerCount];
+        uint64_t range  = atomic_load(&victim->range);
+
+        for (;;)
+        {
+            uint32_t begin = (uint32_t)range, end = (uint32_t)(range >> 32);
+            if (begin >= end) break;
+
+            uint32_t middle = begin + (end - begin) / 2;
+            if (atomic_compare_exchange_weak(&victim->range, &range, PackRange(begin, middle)))
+            {
+                atomic_store(&thief->range, PackRange(middle, end));
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static void *WorkerMain(void *arg)
+{
+    Worker  *worker = arg;
+    uint32_t game;
+
+    do {
+        while (TakeOwn(worker, &game)) PlayGame(game, &worker->stats);
+    } while (Steal(worker));
+
+    return NULL;
+}
+
+static void MergeStats(Stats *total, const Stats *part)
+{
+    total->games    += part->games;
+    total->ticks    += part->ticks;
+    total->scoreSum += part->scoreSum;
+    total->timeSum  += part->timeSum;
+    if (part->maxScore > total->maxScore) total->maxScore = part->maxScore;
+    for (int i = 0; i < SCORE_BINS; i++)  total->scoreHist[i] += part->scoreHist[i];
+    for (int i = 0; i < TIME_BINS; i++)   total->timeHist[i]  += part->timeHist[i];
+    for (int i = 0; i < CAUSE_COUNT; i++) total->causes[i]    += part->causes[i];
+}
+
+// Bin index below which the given fraction of games falls
+static int Percentile(const uint32_t *hist, int bins, uint64_t count, double fraction)
+{
+    uint64_t target = (uint64_t)(count * fraction), seen = 0;
+
+    for (int i = 0; i < bins; i++)
+    {
+        seen += hist[i];
+        if (seen > target) return i;
+    }
+    return bins - 1;
+}
+
+static void PrintHistogram(const char *title, const uint32_t *hist, int bins, float binSize, const char *unit)
+{
+    uint32_t peak = 1;
+    int      last = 0;
+    for (int i = 0; i < bins; i++)
+    {
+        if (hist[i] > peak) peak = hist[i];
+        if (hist[i]) last = i;
+    }
+
+    printf("\n%s\n", title);
+    for (int i = 0; i <= last; i++)
+    {
+        char bar[51];
+        int  length = (int)(hist[i] * 50ull / peak);
+        memset(bar, '#', length);
+        bar[length] = '\0';
+
+        printf("  %5.0f%s%-2s | %-50s %u\n", i * binSize, unit, (i == bins - 1) ? "+" : "", bar, hist[i]);
+    }
+}
+
+static bool ApplyKnob(const char *assignment)
+{
+    const char *equals = strchr(assignment, '=');
+    if (!equals) return false;
+
+    for (size_t i = 0; i < sizeof(knobs) / sizeof(knobs[0]); i++)
+    {
+        if (strlen(knobs[i].name) != (size_t)(equals - assignment) || strncmp(knobs[i].name, assignment, equals - assignment)) continue;
+
+        char *field = (char *)&tuning + knobs[i].offset;
+        if (knobs[i].isFloat) *(float *)field = strtof(equals + 1, NULL);
+        else                  *(int *)field   = atoi(equals + 1);
+        return true;
+    }
+    return false;
+}
+
+static double NowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t    games    = 1000;
+    const char *patterns = "assets/walls.dtw";
+    tuning      = defaultTuning;
+    workerCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg   = argv[i];
+        const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if      (!strcmp(arg, "-n") && value)         { games       = strtoul(value, NULL, 10); i++; }
+        else if (!strcmp(arg, "-j") && value)         { workerCount = atoi(value);              i++; }
+        else if (!strcmp(arg, "-s") && value)         { baseSeed    = strtoul(value, NULL, 10); i++; }
+        else if (!strcmp(arg, "-t") && value)         { maxSeconds  = strtof(value, NULL);      i++; }
+        else if (!strcmp(arg, "--reaction") && value) { skill.reaction  = strtof(value, NULL);  i++; }
+        else if (!strcmp(arg, "--error") && value)    { skill.errorRate = strtof(value, NULL);  i++; }
+        else if (!strcmp(arg, "--set") && value && ApplyKnob(value)) i++;
+        else if (!strcmp(arg, "--level") && value)    { tuning.patternLevel = atoi(value);      i++; }
+        else if (!strcmp(arg, "--patterns") && value) { patterns = value;                       i++; }
+        else
+        {
+            fprintf(stderr, "usage: %s [-n games] [-j threads] [-s seed] [-t seconds] "
+                    "[--reaction s] [--error rate] [--set knob=value ...] [--level n [--patterns file]]\nknobs:", argv[0]);
+            for (size_t k = 0; k < sizeof(knobs) / sizeof(knobs[0]); k++) fprintf(stderr, " %s", knobs[k].name);
+            fprintf(stderr, "\n");
+            return 1;
+        }
+    }
+
+    if (tuning.thicknessEvery < 1) tuning.thicknessEvery = 1;
+    if (tuning.blackHoleOdds < 1)  tuning.blackHoleOdds  = 1;
+    if (workerCount < 1)           workerCount = 1;
+    if (tuning.patternLevel >= 0)
+    {
+        if (!PatternLibraryOpen(patterns) || tuning.patternLevel >= PatternLevelCount())
+        {
+            fprintf(stderr, "%s: no level %d\n", patterns, tuning.patternLevel);
+            return 1;
+        }
+        printf("level %d: %s\n", tuning.patternLevel, PatternLevelName(tuning.patternLevel));
+    }
+    if (workerCount > MAX_THREADS) workerCount = MAX_THREADS;
+
+    // Even split up front; stealing evens out the long games
+    double start = NowSeconds();
+    for (int i = 0; i < workerCount; i++)
+    {
+        workers[i].index = i;
+        atomic_store(&workers[i].range, PackRange((uint64_t)games * i / workerCount, (uint64_t)games * (i + 1) / workerCount));
+    }
+    for (int i = 0; i < workerCount; i++) pthread_create(&workers[i].thread, NULL, WorkerMain, &workers[i]);
+
+    Stats total = { 0 };
+    for (int i = 0; i < workerCount; i++)
+    {
+        pthread_join(workers[i].thread, NULL);
+        MergeStats(&total, &workers[i].stats);
+    }
+    double elapsed = NowSeconds() - start;
+    TRACE_FLUSH(".");
+
+    if (total.games == 0) return 0;
+
+    printf("%llu games on %d threads in %.2fs (%.0f games/s, %.1fM ticks/s)\n",
+            (unsigned long long)total.games, workerCount, elapsed,
+            total.games / elapsed, total.ticks / elapsed / 1e6);
+    printf("score  mean %6.2f   p50 %3d   p90 %3d   max %d\n", total.scoreSum / total.games,
+            Percentile(total.scoreHist, SCORE_BINS, total.games, 0.5),
+            Percentile(total.scoreHist, SCORE_BINS, total.games, 0.9), total.maxScore);
+    printf("time   mean %6.1fs  p50 %3.0fs  p90 %3.0fs\n", total.timeSum / total.games,
+            Percentile(total.timeHist, TIME_BINS, total.games, 0.5) * TIME_BIN_SIZE,
+            Percentile(total.timeHist, TIME_BINS, total.games, 0.9) * TIME_BIN_SIZE);
+    printf("cause  block %.1f%%   barrier %.1f%%   time limit %.1f%%\n",
+            100.0 * total.causes[CAUSE_BLOCK] / total.games,
+            100.0 * total.causes[CAUSE_BARRIER] / total.games,
+            100.0 * total.causes[CAUSE_NONE] / total.games);
+
+    PrintHistogram("score", total.scoreHist, SCORE_BINS, 1, "");
+    PrintHistogram("survival time", total.timeHist, TIME_BINS, TIME_BIN_SIZE, "s");
+    return 0;
+}
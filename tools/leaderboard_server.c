@@ -0,0 +1,271 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - local stand-in leaderboard server
+ *
+ * Usage: leaderboard_server [-p port] [-o scores.txt] [--fail N] [--delay seconds]
+ *
+ * Accepts the game's batched POST /scores, checks every line's digest with the same key as
+ * the client (DEADTYPE_LEADERBOARD_KEY or the default), appends the accepted lines to the
+ * output file and prints the top ten. GET /scores returns the top ten as text.
+ * A run id and seed already stored (this session or in the output file) is acknowledged
+ * but not stored again, so a client retrying after a lost reply can't duplicate a run.
+ * --fail answers the first N submissions with 503 and --delay stalls every reply, to
+ * exercise the client's retry and backoff.
+ *
+ * Point the game at it with DEADTYPE_LEADERBOARD=127.0.0.1:<port>, or on web with
+ * ?leaderboard=http://127.0.0.1:<port>.
+*******************************************************************************************/
+
+#include "../leaderboard.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#define REQUEST_MAX   (64 * 1024)
+#define BOARD_MAX     4096
+#define TOP_COUNT     10
+#define SEEN_MAX      (1 << 16)     // stored runs remembered for duplicates, power of two
+
+static LeaderboardEntry board[BOARD_MAX];
+static int              boardCount = 0;
+static uint8_t          key[16];
+
+// Open-addressed set of the (run id, seed) pairs stored so far
+typedef struct {
+    uint64_t runId;
+    uint32_t seed;
+    bool     used;
+} SeenRun;
+
+static SeenRun          seen[SEEN_MAX];
+static int              seenCount = 0;
+
+// True if the run was new (and is now remembered)
+static bool MarkSeen(const LeaderboardEntry *entry)
+{
+    uint32_t slot = (uint32_t)((entry->runId ^ entry->seed * 0x9E3779B97F4A7C15ULL) >> 40) & (SEEN_MAX - 1);
+    for (; seen[slot].used; slot = (slot + 1) & (SEEN_MAX - 1))
+    {
+        if (seen[slot].runId == entry->runId && seen[slot].seed == entry->seed) return false;
+    }
+
+    // Full: stop remembering rather than refuse scores
+    if (seenCount == SEEN_MAX - 1) return true;
+    seen[slot] = (SeenRun){ entry->runId, entry->seed, true };
+    seenCount++;
+    return true;
+}
+
+static int CompareScores(const void *a, const void *b)
+{
+    const LeaderboardEntry *x = a, *y = b;
+    if (x->score != y->score) return (y->score > x->score) ? 1 : -1;
+    return (x->timestamp > y->timestamp) - (x->timestamp < y->timestamp);   // earlier run wins a tie
+}
+
+static void AddToBoard(const LeaderboardEntry *entry)
+{
+    if (boardCount == BOARD_MAX) boardCount--;   // sorted, so this drops the lowest
+    board[boardCount++] = *entry;
+    qsort(board, boardCount, sizeof(board[0]), CompareScores);
+}
+
+static int FormatTop(char *out, size_t size)
+{
+    int length = 0;
+    for (int i = 0; i < boardCount && i < TOP_COUNT && (size_t)length < size; i++)
+    {
+        length += snprintf(out + length, size - length, "%2d  %5d  %7.1fs  seed %08x\n",
+                           i + 1, board[i].score, board[i].duration, board[i].seed);
+    }
+    return length;
+}
+
+static void LoadBoard(const char *path)
+{
+    FILE *file = fopen(path, "r");
+    if (!file) return;
+
+    char line[LEADERBOARD_LINE_MAX];
+    LeaderboardEntry entry;
+    while (fgets(line, sizeof(line), file))
+    {
+        if (LeaderboardParseLine(line, &entry, key) && MarkSeen(&entry)) AddToBoard(&entry);
+    }
+    fclose(file);
+    printf("Loaded %d scores from %s\n", boardCount, path);
+}
+
+static void Reply(int client, int status, const char *reason, const char *body)
+{
+    char header[256];
+    int length = snprintf(header, sizeof(header),
+            "HTTP/1.0 %d %s\r\nContent-Type: text/plain\r\nAccess-Control-Allow-Origin: *\r\n"
+            "Access-Control-Allow-Headers: Content-Type\r\nContent-Length: %zu\r\n\r\n",
+            status, reason, strlen(body));
+    send(client, header, length, 0);
+    send(client, body, strlen(body), 0);
+}
+
+// Reads headers and a Content-Length body into request; returns 0 with *body set, or the
+// HTTP status to refuse the request with
+static int ReadRequest(int client, char *request, char *method, char *path, char **body)
+{
+    int   length = 0;
+    long  bodyLength = 0;
+    *body = NULL;
+
+    while (!*body || request + length - *body < bodyLength)
+    {
+        if (length == REQUEST_MAX - 1) return 413;
+
+        ssize_t received = recv(client, request + length, REQUEST_MAX - 1 - length, 0);
+        if (received <= 0) return 400;
+        length += received;
+        request[length] = '\0';
+
+        if (!*body && (*body = strstr(request, "\r\n\r\n")))
+        {
+            *body += 4;
+            const char *field = strstr(request, "Content-Length:");
+            if (!field) field = strstr(request, "content-length:");
+            bodyLength = field ? atol(field + 15) : 0;
+
+            // The body has to fit in what's left of the buffer after the headers
+            if (bodyLength < 0) return 400;
+            if (bodyLength > REQUEST_MAX - 1 - (*body - request)) return 413;
+        }
+    }
+
+    (*body)[bodyLength] = '\0';
+    if (sscanf(request, "%15s %255s", method, path) != 2) return 400;
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    int         port     = 8787;
+    const char *output   = "scores.txt";
+    int         failures = 0;
+    double      delay    = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if      (!strcmp(argv[i], "-p") && i + 1 < argc)      port     = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-o") && i + 1 < argc)      output   = argv[++i];
+        else if (!strcmp(argv[i], "--fail") && i + 1 < argc)  failures = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--delay") && i + 1 < argc) delay    = atof(argv[++i]);
+        else
+        {
+            fprintf(stderr, "usage: %s [-p port] [-o scores.txt] [--fail N] [--delay seconds]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+    LeaderboardKey(key);
+    LoadBoard(output);
+
+    int server = socket(AF_INET, SOCK_STREAM, 0);
+    int reuse  = 1;
+    setsockopt(server, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    struct sockaddr_in address = { .sin_family = AF_INET, .sin_port = htons(port), .sin_addr.s_addr = htonl(INADDR_LOOPBACK) };
+    if (bind(server, (struct sockaddr *)&address, sizeof(address)) != 0 || listen(server, 8) != 0)
+    {
+        perror("bind");
+        return 1;
+    }
+    printf("Listening on 127.0.0.1:%d%s\n", port, LEADERBOARD_PATH);
+
+    static char request[REQUEST_MAX];
+    for (;;)
+    {
+        int client = accept(server, NULL, NULL);
+        if (client < 0) continue;
+
+        char  method[16], path[256];
+        char *body;
+        int   refused = ReadRequest(client, request, method, path, &body);
+        if (delay > 0)
+        {
+            struct timespec ts = { (time_t)delay, (long)((delay - (time_t)delay) * 1e9) };
+            nanosleep(&ts, NULL);
+        }
+
+        char reply[1024];
+        if (refused == 413)
+        {
+            Reply(client, 413, "Payload Too Large", "");
+        }
+        else if (refused)
+        {
+            Reply(client, 400, "Bad Request", "");
+        }
+        else if (strcmp(path, LEADERBOARD_PATH))
+        {
+            Reply(client, 404, "Not Found", "");
+        }
+        else if (!strcmp(method, "OPTIONS"))
+        {
+            Reply(client, 204, "No Content", "");
+        }
+        else if (!strcmp(method, "GET"))
+        {
+            FormatTop(reply, sizeof(reply));
+            Reply(client, 200, "OK", reply);
+        }
+        else if (strcmp(method, "POST"))
+        {
+            Reply(client, 405, "Method Not Allowed", "");
+        }
+        else if (failures > 0)
+        {
+            failures--;
+            printf("POST %s: failing on purpose (%d more)\n", path, failures);
+            Reply(client, 503, "Service Unavailable", "");
+        }
+        else
+        {
+            int accepted = 0, duplicates = 0, rejected = 0;
+            FILE *file = fopen(output, "a");
+
+            for (char *line = strtok(body, "\n"); line; line = strtok(NULL, "\n"))
+            {
+                LeaderboardEntry entry;
+                if (!LeaderboardParseLine(line, &entry, key))
+                {
+                    rejected++;
+                    continue;
+                }
+                if (!MarkSeen(&entry))
+                {
+                    duplicates++;
+                    continue;
+                }
+                if (file) fprintf(file, "%s\n", line);
+                AddToBoard(&entry);
+                accepted++;
+            }
+            if (file) fclose(file);
+
+            printf("POST %s: %d runs accepted, %d duplicates, %d rejected\n", path, accepted, duplicates, rejected);
+            FormatTop(reply, sizeof(reply));
+            fputs(reply, stdout);
+            fflush(stdout);
+
+            // Duplicates count as delivered. All lines damaged or malformed: 400 so the client
+            // stops retrying them
+            snprintf(reply, sizeof(reply), "accepted %d duplicates %d rejected %d\n", accepted, duplicates, rejected);
+            if (accepted + duplicates == 0 && rejected > 0) Reply(client, 400, "Bad Request", reply);
+            else                               Reply(client, 200, "OK", reply);
+        }
+
+        close(client);
+    }
+}
@@ -0,0 +1,256 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - learning environment server
+ *
+ * Usage: rlenv [-n instances] [-j threads] [--shm name] [--frame-skip ticks] [-t seconds]
+ *              [--words] [--level n [--patterns walls.dtw]] [--bench seconds]
+ *
+ * Creates the shared-memory segment described in env.h and steps its instances on every
+ * core until a client sets the shutdown flag (or SIGINT/SIGTERM). Each worker owns every
+ * j-th instance and spins over their request rings, backing off to sleeps when idle.
+ * --bench also runs a random agent client in-process over the same segment and prints
+ * the step rate, which is what an external client can expect at best.
+*******************************************************************************************/
+
+#include "../env.h"
+#include "../patterns.h"
+#include "../trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define MAX_THREADS       256
+#define IDLE_SPINS        64        // empty passes before yielding
+#define IDLE_YIELDS       4096      // then before sleeping between passes
+#define IDLE_SLEEP_NS     50000
+#define BENCH_IN_FLIGHT   (ENV_RING_SIZE / 2)
+
+/*******************************************************************************************
+*  DATA STRUCTURES
+*******************************************************************************************/
+
+typedef struct {
+    pthread_t thread;
+    int       index;
+    uint64_t  steps;
+} Worker;
+
+/*******************************************************************************************
+*  GLOBAL VARIABLES
+*******************************************************************************************/
+
+static Worker               workers[MAX_THREADS];
+static int                  workerCount = 0;
+static EnvSharedHeader     *shared      = NULL;
+static EnvInstance         *instances   = NULL;
+static volatile sig_atomic_t interrupted = 0;
+
+/*******************************************************************************************
+*  FUNCTION DEFINITIONS
+*******************************************************************************************/
+
+static void OnSignal(int signal)
+{
+    (void)signal;
+    interrupted = 1;
+}
+
+static double NowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static bool Running(void)
+{
+    return !interrupted && !atomic_load_explicit(&shared->shutdown, memory_order_relaxed);
+}
+
+static void *WorkerMain(void *arg)
+{
+    Worker *worker = arg;
+    int     idle   = 0;
+    TRACE_THREAD("env worker");
+
+    while (Running())
+    {
+        int served = 0;
+        for (uint32_t i = worker->index; i < shared->instanceCount; i += workerCount)
+        {
+            served += EnvServeChannel(EnvSharedChannel(shared, i), &instances[i]);
+        }
+        worker->steps += served;
+
+        if (served)                   idle = 0;
+        else if (++idle < IDLE_SPINS) continue;
+        else if (idle < IDLE_YIELDS)  sched_yield();
+        else                          nanosleep(&(struct timespec){ 0, IDLE_SLEEP_NS }, NULL);
+    }
+    return NULL;
+}
+
+static uint32_t BenchRandom(uint32_t *rng)
+{
+    uint32_t x = *rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *rng = x;
+}
+
+// A random agent over the shared segment, attached the way an external client would be
+static void RunBench(const char *name, float seconds)
+{
+    EnvSharedHeader *header = EnvSharedAttach(name);
+    if (!header)
+    {
+        fprintf(stderr, "%s: can't attach\n", name);
+        return;
+    }
+
+    uint32_t count    = header->instanceCount;
+    uint32_t rng      = 0xBE7C4u;
+    uint64_t steps    = 0, episodes = 0, scoreSum = 0;
+    double   start    = NowSeconds();
+    double   deadline = start + seconds;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        EnvChannel *channel = EnvSharedChannel(header, i);
+        EnvPushRequest(channel, ENV_REQUEST_RESET, i + 1);
+        for (int k = 1; k < BENCH_IN_FLIGHT; k++) EnvPushRequest(channel, ENV_REQUEST_STEP, ENV_ACTION(ENV_MOVE_NONE, -1));
+    }
+
+    while (NowSeconds() < deadline && !interrupted)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            EnvChannel      *channel = EnvSharedChannel(header, i);
+            const EnvResult *result;
+            while ((result = EnvPeekResult(channel)))
+            {
+                bool over = result->done || result->truncated;
+                if (over)
+                {
+                    episodes++;
+                    scoreSum += result->observation.score;
+                }
+                EnvReleaseResult(channel);
+                steps++;
+
+                if (over) EnvPushRequest(channel, ENV_REQUEST_RESET, BenchRandom(&rng));
+                else      EnvPushRequest(channel, ENV_REQUEST_STEP, BenchRandom(&rng) % ENV_ACTION_COUNT);
+            }
+        }
+    }
+
+    double elapsed = NowSeconds() - start;
+    printf("%llu steps in %.2fs (%.0f steps/s, %.1fM ticks/s), %llu episodes, mean score %.2f\n",
+            (unsigned long long)steps, elapsed, steps / elapsed, steps * header->frameSkip / elapsed / 1e6,
+            (unsigned long long)episodes, episodes ? (double)scoreSum / episodes : 0.0);
+
+    atomic_store(&header->shutdown, 1);
+    EnvSharedClose(header, NULL);
+}
+
+static void *BenchMain(void *arg)
+{
+    const char **args = arg;
+    RunBench(args[0], strtof(args[1], NULL));
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t    count      = 64;
+    int         frameSkip  = 4;
+    float       maxSeconds = 600.0f;
+    const char *name       = "/deadtype-env";
+    const char *patterns   = "assets/walls.dtw";
+    const char *bench      = NULL;
+    GameTuning  tuning     = defaultTuning;
+    workerCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg   = argv[i];
+        const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if      (!strcmp(arg, "-n") && value)           { count       = strtoul(value, NULL, 10); i++; }
+        else if (!strcmp(arg, "-j") && value)           { workerCount = atoi(value);              i++; }
+        else if (!strcmp(arg, "-t") && value)           { maxSeconds  = strtof(value, NULL);      i++; }
+        else if (!strcmp(arg, "--shm") && value)        { name        = value;                    i++; }
+        else if (!strcmp(arg, "--frame-skip") && value) { frameSkip   = atoi(value);              i++; }
+        else if (!strcmp(arg, "--level") && value)      { tuning.patternLevel = atoi(value);      i++; }
+        else if (!strcmp(arg, "--patterns") && value)   { patterns    = value;                    i++; }
+        else if (!strcmp(arg, "--bench") && value)      { bench       = value;                    i++; }
+        else if (!strcmp(arg, "--words"))               tuning.wordMode = true;
+        else
+        {
+            fprintf(stderr, "usage: %s [-n instances] [-j threads] [--shm name] [--frame-skip ticks] [-t seconds] "
+                    "[--words] [--level n [--patterns file]] [--bench seconds]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (count < 1)                 count = 1;
+    if (workerCount < 1)           workerCount = 1;
+    if (workerCount > MAX_THREADS) workerCount = MAX_THREADS;
+    if (workerCount > (int)count)  workerCount = (int)count;
+    if (tuning.patternLevel >= 0 && (!PatternLibraryOpen(patterns) || tuning.patternLevel >= PatternLevelCount()))
+    {
+        fprintf(stderr, "%s: no level %d\n", patterns, tuning.patternLevel);
+        return 1;
+    }
+
+    instances = malloc(count * sizeof(EnvInstance));
+    if (!instances) return 1;
+    for (uint32_t i = 0; i < count; i++) EnvInit(&instances[i], &tuning, frameSkip, maxSeconds);
+
+    shared = EnvSharedCreate(name, count, frameSkip, maxSeconds);
+    if (!shared)
+    {
+        perror(name);
+        return 1;
+    }
+
+    signal(SIGINT, OnSignal);
+    signal(SIGTERM, OnSignal);
+    printf("%s: %u instances on %d threads, %d ticks per step, %zu-byte observations\n",
+            name, count, workerCount, frameSkip, sizeof(EnvObservation));
+    fflush(stdout);
+
+    for (int i = 0; i < workerCount; i++)
+    {
+        workers[i].index = i;
+        pthread_create(&workers[i].thread, NULL, WorkerMain, &workers[i]);
+    }
+
+    pthread_t   benchThread;
+    const char *benchArgs[2] = { name, bench };
+    if (bench) pthread_create(&benchThread, NULL, BenchMain, benchArgs);
+
+    uint64_t steps = 0;
+    for (int i = 0; i < workerCount; i++)
+    {
+        pthread_join(workers[i].thread, NULL);
+        steps += workers[i].steps;
+    }
+    if (bench) pthread_join(benchThread, NULL);
+    TRACE_FLUSH(".");
+
+    printf("%s: served %llu steps\n", name, (unsigned long long)steps);
+    EnvSharedClose(shared, name);
+    free(instances);
+    PatternLibraryClose();
+    return 0;
+}
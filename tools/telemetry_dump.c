@@ -0,0 +1,107 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - telemetry log converter
+ *
+ * Usage: telemetry_dump [--json] telemetry.bin [telemetry.1.bin ...]
+ *
+ * Prints every record of the given logs as CSV (default) or one JSON object per line.
+ * A truncated final batch (game killed mid-write) is reported and skipped.
+*******************************************************************************************/
+
+#include "raylib.h"
+#include "../telemetry.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *typeNames[TELE_TYPE_COUNT] = {
+    "run_start", "key_press", "block_destroyed", "wrong_key", "wall_passed", "black_hole", "death",
+};
+
+static void PrintRecord(const TelemetryRecord *r, bool json)
+{
+    const char *type = (r->type < TELE_TYPE_COUNT) ? typeNames[r->type] : "unknown";
+    char key[2] = { r->key ? r->key : '\0', '\0' };
+
+    if (json)
+    {
+        printf("{\"run\":%u,\"time\":%.4f,\"type\":\"%s\",\"key\":\"%s\",\"count\":%u,\"x\":%.1f,\"y\":%.1f,\"value\":%.4f}\n",
+                r->runId, r->time, type, key, r->count, r->x, r->y, r->value);
+    }
+    else
+    {
+        printf("%u,%.4f,%s,%s,%u,%.1f,%.1f,%.4f\n", r->runId, r->time, type, key, r->count, r->x, r->y, r->value);
+    }
+}
+
+// Decodes one log file; returns false on a read error
+static bool DumpFile(const char *path, bool json)
+{
+    FILE *file = fopen(path, "rb");
+    if (!file)
+    {
+        fprintf(stderr, "%s: can't open\n", path);
+        return false;
+    }
+
+    TelemetryBatchHeader header;
+    while (fread(&header, sizeof(header), 1, file) == 1)
+    {
+        if (header.magic != TELEMETRY_MAGIC)
+        {
+            fprintf(stderr, "%s: bad batch header, stopping\n", path);
+            break;
+        }
+
+        unsigned char *compressed = MemAlloc(header.compressedSize);
+        if (fread(compressed, 1, header.compressedSize, file) != header.compressedSize)
+        {
+            fprintf(stderr, "%s: truncated final batch skipped\n", path);
+            MemFree(compressed);
+            break;
+        }
+
+        int size = 0;
+        TelemetryRecord *records = (TelemetryRecord *)DecompressData(compressed, header.compressedSize, &size);
+        MemFree(compressed);
+
+        if (!records || size != (int)(header.count * sizeof(TelemetryRecord)))
+        {
+            fprintf(stderr, "%s: corrupt batch skipped\n", path);
+        }
+        else
+        {
+            for (uint32_t i = 0; i < header.count; i++) PrintRecord(&records[i], json);
+        }
+        MemFree(records);
+    }
+
+    fclose(file);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    bool json  = false;
+    int  first = 1;
+
+    if (argc > 1 && !strcmp(argv[1], "--json"))
+    {
+        json  = true;
+        first = 2;
+    }
+
+    if (first >= argc)
+    {
+        fprintf(stderr, "usage: %s [--json] telemetry.bin [...]\n", argv[0]);
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    if (!json) printf("run,time,type,key,count,x,y,value\n");
+
+    int status = 0;
+    for (int i = first; i < argc; i++)
+    {
+        if (!DumpFile(argv[i], json)) status = 1;
+    }
+    return status;
+}
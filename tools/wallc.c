@@ -0,0 +1,261 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - wall pattern compiler
+ *
+ * Usage: wallc -o walls.dtw levels/a.txt [levels/b.txt ...]
+ *
+ * Builds the binary pattern library (patterns.h) from text levels. A level starts with
+ * "level <name>" and is followed by its walls, separated by blank lines. A wall is exactly
+ * WALL_ROWS lines of the same length (1 to WALL_MAX_THICKNESS columns): a letter or digit is
+ * a breakable block carrying it, '#' is a barrier. W and S are the movement keys, so they
+ * can't be on blocks, and every wall needs at least one row without barriers.
+ * Lines starting with // are comments.
+*******************************************************************************************/
+
+#include "../patterns.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LINE_MAX_LENGTH   256
+#define MAX_LEVELS        4096
+#define MAX_WALLS         (1 << 20)
+#define RECORD_MAX        (1 + WALL_ROWS + (WALL_ROWS * WALL_MAX_THICKNESS * PATTERN_LETTER_BITS + 7) / 8)
+
+static PatternLevel levels[MAX_LEVELS];
+static int          levelCount = 0;
+static uint8_t     *records    = NULL;    // all wall records back to back
+static uint32_t    *wallEnds   = NULL;    // end of each record within records
+static uint32_t     wallCount  = 0;
+
+// Packs one wall; returns its record size or 0 with a message
+static int EncodeWall(char rows[WALL_ROWS][LINE_MAX_LENGTH], const char *path, int line, uint8_t *out)
+{
+    int thickness = (int)strlen(rows[0]);
+    if (thickness < 1 || thickness > WALL_MAX_THICKNESS)
+    {
+        fprintf(stderr, "%s:%d: wall is %d columns wide (1 to %d)\n", path, line, thickness, WALL_MAX_THICKNESS);
+        return 0;
+    }
+
+    memset(out, 0, RECORD_MAX);
+    out[0] = (uint8_t)thickness;
+
+    bool   passable = false;
+    size_t bit      = 0;
+    for (int row = 0; row < WALL_ROWS; row++)
+    {
+        if ((int)strlen(rows[row]) != thickness)
+        {
+            fprintf(stderr, "%s:%d: row %d is not %d columns wide\n", path, line + row, row + 1, thickness);
+            return 0;
+        }
+
+        bool open = true;
+        for (int col = 0; col < thickness; col++)
+        {
+            char cell = rows[row][col];
+            if (cell == '#')
+            {
+                open = false;
+                continue;
+            }
+
+            int code = PatternLetterCode(cell);
+            if (code < 0)
+            {
+                fprintf(stderr, "%s:%d: '%c' can't be on a block\n", path, line + row, cell);
+                return 0;
+            }
+
+            out[1 + row] |= 1u << col;
+            for (int i = 0; i < PATTERN_LETTER_BITS; i++, bit++)
+            {
+                if (code & (1 << i)) out[1 + WALL_ROWS + (bit >> 3)] |= 1u << (bit & 7);
+            }
+        }
+        passable |= open;
+    }
+
+    if (!passable)
+    {
+        fprintf(stderr, "%s:%d: wall has no row without barriers\n", path, line);
+        return 0;
+    }
+    return 1 + WALL_ROWS + (int)((bit + 7) / 8);
+}
+
+static bool AddWall(char rows[WALL_ROWS][LINE_MAX_LENGTH], const char *path, int line)
+{
+    static uint32_t used = 0;
+    uint8_t record[RECORD_MAX];
+
+    if (levelCount == 0)
+    {
+        fprintf(stderr, "%s:%d: wall before the first \"level\" line\n", path, line);
+        return false;
+    }
+    if (wallCount == MAX_WALLS)
+    {
+        fprintf(stderr, "%s:%d: more than %d walls\n", path, line, MAX_WALLS);
+        return false;
+    }
+
+    int size = EncodeWall(rows, path, line, record);
+    if (!size) return false;
+
+    memcpy(records + used, record, size);
+    used += size;
+    wallEnds[wallCount++] = used;
+    levels[levelCount - 1].wallCount++;
+    return true;
+}
+
+static bool CompileFile(const char *path)
+{
+    FILE *file = fopen(path, "r");
+    if (!file)
+    {
+        perror(path);
+        return false;
+    }
+
+    char line[LINE_MAX_LENGTH];
+    char rows[WALL_ROWS][LINE_MAX_LENGTH];
+    int  rowCount = 0, lineNumber = 0, wallLine = 0;
+    bool ok = true;
+
+    while (ok && fgets(line, sizeof(line), file))
+    {
+        lineNumber++;
+        line[strcspn(line, "\r\n")] = '\0';
+        if (!strncmp(line, "//", 2)) continue;
+
+        if (!strncmp(line, "level ", 6))
+        {
+            if (rowCount)
+            {
+                fprintf(stderr, "%s:%d: wall has %d rows, needs %d\n", path, wallLine, rowCount, WALL_ROWS);
+                ok = false;
+            }
+            else if (levelCount > 0 && levels[levelCount - 1].wallCount == 0)
+            {
+                fprintf(stderr, "%s:%d: level \"%s\" has no walls\n", path, lineNumber, levels[levelCount - 1].name);
+                ok = false;
+            }
+            else if (levelCount == MAX_LEVELS)
+            {
+                fprintf(stderr, "%s:%d: more than %d levels\n", path, lineNumber, MAX_LEVELS);
+                ok = false;
+            }
+            else
+            {
+                PatternLevel *level = &levels[levelCount++];
+                memset(level, 0, sizeof(*level));
+                size_t length = strlen(line + 6);
+                memcpy(level->name, line + 6, (length < PATTERN_NAME_LENGTH) ? length : PATTERN_NAME_LENGTH - 1);
+                level->firstWall = wallCount;
+            }
+            continue;
+        }
+
+        if (line[0] == '\0')
+        {
+            if (rowCount)
+            {
+                fprintf(stderr, "%s:%d: wall has %d rows, needs %d\n", path, wallLine, rowCount, WALL_ROWS);
+                ok = false;
+            }
+            continue;
+        }
+
+        if (rowCount == 0) wallLine = lineNumber;
+        strcpy(rows[rowCount++], line);
+        if (rowCount == WALL_ROWS)
+        {
+            ok = AddWall(rows, path, wallLine);
+            rowCount = 0;
+        }
+    }
+    fclose(file);
+
+    if (ok && rowCount)
+    {
+        fprintf(stderr, "%s:%d: wall has %d rows, needs %d\n", path, wallLine, rowCount, WALL_ROWS);
+        ok = false;
+    }
+    return ok;
+}
+
+static bool WriteLibrary(const char *path)
+{
+    PatternHeader header = {
+        .magic        = PATTERN_MAGIC,
+        .version      = PATTERN_VERSION,
+        .rows         = WALL_ROWS,
+        .maxThickness = WALL_MAX_THICKNESS,
+        .levelCount   = levelCount,
+        .wallCount    = wallCount,
+    };
+
+    // Record offsets are from the start of the file
+    uint32_t base = sizeof(header) + levelCount * sizeof(PatternLevel) + (wallCount + 1) * sizeof(uint32_t);
+    FILE *file = fopen(path, "wb");
+    if (!file)
+    {
+        perror(path);
+        return false;
+    }
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    ok &= fwrite(levels, sizeof(PatternLevel), levelCount, file) == (size_t)levelCount;
+    for (uint32_t i = 0; i <= wallCount && ok; i++)
+    {
+        uint32_t offset = base + (i ? wallEnds[i - 1] : 0);
+        ok &= fwrite(&offset, sizeof(offset), 1, file) == 1;
+    }
+    uint32_t used = wallCount ? wallEnds[wallCount - 1] : 0;
+    ok &= fwrite(records, 1, used, file) == used;
+    ok &= fclose(file) == 0;
+
+    if (!ok) fprintf(stderr, "%s: write failed\n", path);
+    else     printf("%s: %d levels, %u walls, %u bytes\n", path, levelCount, wallCount, base + used);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    const char *output = NULL;
+    int         first  = 1;
+
+    if (argc > 2 && !strcmp(argv[1], "-o"))
+    {
+        output = argv[2];
+        first  = 3;
+    }
+    if (!output || first >= argc)
+    {
+        fprintf(stderr, "usage: %s -o walls.dtw levels.txt [...]\n", argv[0]);
+        return 1;
+    }
+
+    records  = malloc((size_t)MAX_WALLS * RECORD_MAX);
+    wallEnds = malloc((size_t)MAX_WALLS * sizeof(uint32_t));
+    if (!records || !wallEnds) return 1;
+
+    for (int i = first; i < argc; i++)
+    {
+        if (!CompileFile(argv[i])) return 1;
+    }
+    if (levelCount > 0 && levels[levelCount - 1].wallCount == 0)
+    {
+        fprintf(stderr, "level \"%s\" has no walls\n", levels[levelCount - 1].name);
+        return 1;
+    }
+    if (levelCount == 0)
+    {
+        fprintf(stderr, "no levels\n");
+        return 1;
+    }
+
+    return WriteLibrary(output) ? 0 : 1;
+}
@@ -0,0 +1,180 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - frame trace zones
+*******************************************************************************************/
+
+#include "trace.h"
+
+#ifdef DEADTYPE_TRACE
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifdef PLATFORM_WEB
+    #include <emscripten/emscripten.h>
+#endif
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define TRACE_FLUSH_SLACK   256     // oldest slots skipped on flush: the owner may be overwriting them
+#define TRACE_NAME_LENGTH   32
+
+/*******************************************************************************************
+*  DATA STRUCTURES
+*******************************************************************************************/
+
+typedef struct {
+    const char *name;
+    uint64_t    start;      // ns on the trace clock
+    uint64_t    duration;   // ns, unused for instants
+    char        phase;      // 'X' complete zone, 'i' instant
+} TraceEvent;
+
+// Written only by its own thread; the flusher reads up to head
+typedef struct {
+    TraceEvent  events[TRACE_BUFFER_EVENTS];
+    atomic_uint head;       // events ever written
+    int         tid;
+    char        threadName[TRACE_NAME_LENGTH];
+} TraceBuffer;
+
+/*******************************************************************************************
+*  GLOBAL VARIABLES
+*******************************************************************************************/
+
+static _Atomic(TraceBuffer *) buffers[TRACE_MAX_THREADS];
+static atomic_int             bufferCount = 0;
+static _Thread_local TraceBuffer *localBuffer = NULL;
+static _Thread_local bool         localFull   = false;   // thread arrived after TRACE_MAX_THREADS
+
+/*******************************************************************************************
+*  FUNCTION DEFINITIONS
+*******************************************************************************************/
+
+static uint64_t TraceClock(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+// The calling thread's buffer, allocated on its first event
+static TraceBuffer *LocalBuffer(void)
+{
+    if (localBuffer || localFull) return localBuffer;
+
+    int index = atomic_fetch_add(&bufferCount, 1);
+    TraceBuffer *buffer = (index < TRACE_MAX_THREADS) ? calloc(1, sizeof(TraceBuffer)) : NULL;
+    if (!buffer)
+    {
+        localFull = true;
+        return NULL;
+    }
+
+    buffer->tid = index + 1;
+    snprintf(buffer->threadName, sizeof(buffer->threadName), "thread %d", buffer->tid);
+    atomic_store(&buffers[index], buffer);
+    return localBuffer = buffer;
+}
+
+static void Record(const char *name, uint64_t start, uint64_t duration, char phase)
+{
+    TraceBuffer *buffer = LocalBuffer();
+    if (!buffer) return;
+
+    unsigned int head = atomic_load_explicit(&buffer->head, memory_order_relaxed);
+    buffer->events[head % TRACE_BUFFER_EVENTS] = (TraceEvent){ name, start, duration, phase };
+    atomic_store_explicit(&buffer->head, head + 1, memory_order_release);
+}
+
+TraceZone TraceZoneBegin(const char *name)
+{
+    return (TraceZone){ name, TraceClock() };
+}
+
+void TraceZoneEnd(TraceZone *zone)
+{
+    Record(zone->name, zone->start, TraceClock() - zone->start, 'X');
+}
+
+void TraceInstant(const char *name)
+{
+    Record(name, TraceClock(), 0, 'i');
+}
+
+void TraceThreadName(const char *name)
+{
+    TraceBuffer *buffer = LocalBuffer();
+    if (buffer) snprintf(buffer->threadName, sizeof(buffer->threadName), "%s", name);
+}
+
+bool TraceFlush(const char *dir)
+{
+    static int flushes = 0;     // F4 twice within a second shouldn't overwrite
+    char path[512];
+    snprintf(path, sizeof(path), "%s/trace-%ld-%d.json", dir, (long)time(NULL), flushes++);
+
+    FILE *file = fopen(path, "w");
+    if (!file)
+    {
+        fprintf(stderr, "TRACE: Can't write %s\n", path);
+        return false;
+    }
+
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    fprintf(file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"0xDEAD//TYPE\"}}");
+
+    int threads = atomic_load(&bufferCount);
+    int written = 0;
+    for (int t = 0; t < threads && t < TRACE_MAX_THREADS; t++)
+    {
+        TraceBuffer *buffer = atomic_load(&buffers[t]);
+        if (!buffer) continue;
+
+        fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                buffer->tid, buffer->threadName);
+
+        unsigned int head  = atomic_load_explicit(&buffer->head, memory_order_acquire);
+        unsigned int count = (head < TRACE_BUFFER_EVENTS - TRACE_FLUSH_SLACK) ? head : TRACE_BUFFER_EVENTS - TRACE_FLUSH_SLACK;
+        for (unsigned int i = head - count; i != head; i++)
+        {
+            const TraceEvent *event = &buffer->events[i % TRACE_BUFFER_EVENTS];
+            if (event->phase == 'X')
+            {
+                fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                        event->name, buffer->tid, event->start / 1000.0, event->duration / 1000.0);
+            }
+            else
+            {
+                fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%d,\"ts\":%.3f}",
+                        event->name, buffer->tid, event->start / 1000.0);
+            }
+        }
+        written += count;
+    }
+
+    fprintf(file, "\n]}\n");
+    bool ok = (fclose(file) == 0);
+    // stderr rather than TraceLog so headless tools (batchsim) can link this without raylib
+    fprintf(stderr, "TRACE: %d events from %d threads written to %s\n", written, threads, path);
+
+#ifdef PLATFORM_WEB
+    // Nowhere to find the file in the browser, so hand it over as a download
+    if (ok)
+    {
+        EM_ASM({
+            var path = UTF8ToString($0);
+            var link = document.createElement("a");
+            link.href = URL.createObjectURL(new Blob([FS.readFile(path)], { type: "application/json" }));
+            link.download = path.split("/").pop();
+            link.click();
+        }, path);
+    }
+#endif
+    return ok;
+}
+
+#endif // DEADTYPE_TRACE
@@ -0,0 +1,71 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - frame trace zones
+ *
+ * Build with TRACE=1 (defines DEADTYPE_TRACE) to record scoped timing zones into a ring
+ * buffer per thread, then write them out as Chrome trace-event JSON: F4 in game, and again
+ * on exit. Open the file in chrome://tracing or ui.perfetto.dev to step through a hitch
+ * frame by frame. Without the flag every macro expands to nothing.
+ *
+ *   TRACE_ZONE("name");          times the rest of the enclosing block
+ *   TRACE_BEGIN(var, "name");    times up to TRACE_END(var), for spans that aren't a block
+ *   TRACE_INSTANT("name");       a point event
+ *   TRACE_THREAD("name");        labels the calling thread in the viewer
+ *
+ * Names must be string literals (only the pointer is stored).
+*******************************************************************************************/
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef DEADTYPE_TRACE
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define TRACE_BUFFER_EVENTS   (1 << 16)   // per thread; the oldest are overwritten
+#define TRACE_MAX_THREADS     16
+
+#define TRACE_CONCAT_(a, b)       a##b
+#define TRACE_CONCAT(a, b)        TRACE_CONCAT_(a, b)
+#define TRACE_ZONE(name)          TraceZone TRACE_CONCAT(traceZone, __LINE__) __attribute__((cleanup(TraceZoneEnd))) = TraceZoneBegin(name)
+#define TRACE_BEGIN(var, name)    TraceZone var = TraceZoneBegin(name)
+#define TRACE_END(var)            TraceZoneEnd(&var)
+#define TRACE_INSTANT(name)       TraceInstant(name)
+#define TRACE_THREAD(name)        TraceThreadName(name)
+#define TRACE_FLUSH(dir)          TraceFlush(dir)
+
+/*******************************************************************************************
+*  DATA STRUCTURES
+*******************************************************************************************/
+
+typedef struct {
+    const char *name;
+    uint64_t    start;    // ns on the trace clock
+} TraceZone;
+
+/*******************************************************************************************
+*  FUNCTION DECLARATIONS
+*******************************************************************************************/
+
+TraceZone TraceZoneBegin(const char *name);
+void      TraceZoneEnd(TraceZone *zone);
+void      TraceInstant(const char *name);
+void      TraceThreadName(const char *name);
+bool      TraceFlush(const char *dir);    // writes <dir>/trace-<time>-<n>.json (downloaded on web)
+
+#else
+
+#define TRACE_ZONE(name)
+#define TRACE_BEGIN(var, name)
+#define TRACE_END(var)
+#define TRACE_INSTANT(name)
+#define TRACE_THREAD(name)
+#define TRACE_FLUSH(dir)          ((void)0)
+
+#endif // DEADTYPE_TRACE
+
+#endif // TRACE_H
@@ -0,0 +1,154 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - word typing mode
+*******************************************************************************************/
+
+#include "words.h"
+#include <string.h>
+
+/*******************************************************************************************
+*  GLOBAL VARIABLES
+*******************************************************************************************/
+
+const char *const wordList[] = {
+    "NULL", "VOID", "ROOT", "HEAP", "FORK", "EXEC", "KILL", "PING", "GREP", "CURL",
+    "ECHO", "TRAP", "JUMP", "LOOP", "BYTE", "FLAG", "HALT", "CORE", "DUMP", "PIPE",
+    "PANIC", "BREAK", "PATCH", "TOKEN", "PROXY", "MUTEX", "INODE", "CACHE", "FETCH", "YIELD",
+    "CIPHER", "KERNEL", "BUFFER", "DAEMON", "REBOOT", "GLITCH", "MALLOC", "UNLINK", "LAMBDA", "OPCODE",
+    "UPLINK", "EXPLOIT", "PAYLOAD", "BACKDOOR", "DEADBEEF", "C0FFEE", "BADC0DE", "XOR", "NOP", "RET",
+};
+const int wordListCount = sizeof(wordList) / sizeof(wordList[0]);
+
+/*******************************************************************************************
+*  FUNCTION DEFINITIONS
+*******************************************************************************************/
+
+static uint16_t FindChild(const WordMatcher *m, uint16_t node, char letter)
+{
+    for (uint16_t child = m->nodes[node].child; child; child = m->nodes[child].sibling)
+    {
+        if (m->nodes[child].letter == letter) return child;
+    }
+    return 0;
+}
+
+// Breadth-first over the trie: a node's fail link only depends on shallower ones
+void WordMatcherLink(WordMatcher *m)
+{
+    uint16_t queue[WORD_TRIE_NODES];
+    int      head = 0, tail = 0;
+
+    for (uint16_t child = m->nodes[0].child; child; child = m->nodes[child].sibling)
+    {
+        m->nodes[child].fail = 0;
+        queue[tail++] = child;
+    }
+
+    while (head < tail)
+    {
+        uint16_t node = queue[head++];
+        for (uint16_t child = m->nodes[node].child; child; child = m->nodes[child].sibling)
+        {
+            char     letter = m->nodes[child].letter;
+            uint16_t fail   = m->nodes[node].fail;
+            while (fail && !FindChild(m, fail, letter)) fail = m->nodes[fail].fail;
+
+            uint16_t next = FindChild(m, fail, letter);
+            m->nodes[child].fail = (next != child) ? next : 0;
+            queue[tail++] = child;
+        }
+    }
+}
+
+void WordMatcherClear(WordMatcher *m)
+{
+    memset(&m->nodes[0], 0, sizeof(m->nodes[0]));
+    m->nodeCount = 1;
+    m->state     = 0;
+}
+
+bool WordMatcherAdd(WordMatcher *m, const char *word, int target)
+{
+    // Check for room first so a failed add leaves no half-inserted path
+    int      length = (int)strlen(word);
+    uint16_t node   = 0;
+    int      depth  = 0;
+    for (uint16_t next; depth < length && (next = FindChild(m, node, word[depth])); depth++) node = next;
+    if (m->nodeCount + (length - depth) > WORD_TRIE_NODES) return false;
+
+    for (; depth < length; depth++)
+    {
+        uint16_t child = m->nodeCount++;
+        m->nodes[child] = (WordNode){
+            .sibling = m->nodes[node].child,
+            .parent  = node,
+            .letter  = word[depth],
+            .depth   = (uint8_t)(depth + 1),
+        };
+        m->nodes[node].child = child;
+        node = child;
+    }
+
+    m->nodes[node].targets |= 1ULL << target;
+    return true;
+}
+
+// The path stays in the trie until the matcher is cleared and rebuilt
+void WordMatcherRemove(WordMatcher *m, const char *word, int target)
+{
+    uint16_t node = 0;
+    for (int i = 0; word[i] && node != 0xFFFF; i++)
+    {
+        uint16_t next = FindChild(m, node, word[i]);
+        node = next ? next : 0xFFFF;
+    }
+    if (node != 0xFFFF) m->nodes[node].targets &= ~(1ULL << target);
+}
+
+uint64_t WordMatcherFeed(WordMatcher *m, char key)
+{
+    // Standard goto/fail transition
+    uint16_t state = m->state;
+    while (state && !FindChild(m, state, key)) state = m->nodes[state].fail;
+    state = FindChild(m, state, key);
+    m->state = state;
+
+    // The longest live word ending here (the state itself or a suffix of it) is completed
+    for (uint16_t node = state; node; node = m->nodes[node].fail)
+    {
+        if (m->nodes[node].targets)
+        {
+            m->state = 0;
+            return m->nodes[node].targets;
+        }
+    }
+    return 0;
+}
+
+int WordMatcherTyped(const WordMatcher *m, char *out)
+{
+    int length = m->nodes[m->state].depth;
+    out[length] = '\0';
+    for (uint16_t node = m->state; node; node = m->nodes[node].parent) out[m->nodes[node].depth - 1] = m->nodes[node].letter;
+    return length;
+}
+
+// Longest prefix of word that is a suffix of what was typed: the deepest node on the
+// state's fail chain that also lies on word's path
+int WordMatcherProgress(const WordMatcher *m, const char *word)
+{
+    uint16_t path[WORD_MAX_LENGTH + 1] = { 0 };
+    int      length = 0;
+    for (uint16_t node = 0; length < WORD_MAX_LENGTH && word[length]; length++)
+    {
+        node = FindChild(m, node, word[length]);
+        if (!node) break;
+        path[length + 1] = node;
+    }
+
+    for (uint16_t node = m->state; node; node = m->nodes[node].fail)
+    {
+        int depth = m->nodes[node].depth;
+        if (depth <= length && path[depth] == node) return depth;
+    }
+    return 0;
+}
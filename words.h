@@ -0,0 +1,68 @@
+/*******************************************************************************************
+ * 0xDEAD//TYPE - word typing mode
+ *
+ * In word mode every wall row carries a word or hex token (0xDEAD) that has to be typed in
+ * full. The live words are kept in an Aho-Corasick automaton: one state tracks the longest
+ * typed suffix that is a prefix of any live word, so each keystroke advances every
+ * partially typed target at once in time bounded by the word length, however many
+ * targets are on screen.
+ *
+ * The automaton is flat (indices, no pointers) and lives at the end of GameState, so it is
+ * snapshotted and rolled back with the rest of the run in word mode; GameCopy leaves it out
+ * otherwise. Fail links are rebuilt by WordMatcherLink when a wall's words are added, never
+ * on a keystroke.
+*******************************************************************************************/
+
+#ifndef WORDS_H
+#define WORDS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*******************************************************************************************
+*  DEFINES & CONSTANTS
+*******************************************************************************************/
+
+#define WORD_MAX_LENGTH   8
+#define WORD_TRIE_NODES   512     // live words need at most 45 * 8 + 1; the rest is slack for removed ones
+
+/*******************************************************************************************
+*  DATA STRUCTURES
+*******************************************************************************************/
+
+typedef struct {
+    uint64_t targets;     // live targets whose word ends here (bit = wall * WALL_ROWS + row)
+    uint16_t child;       // first child, 0 if none (the root is never a child)
+    uint16_t sibling;     // next child of the same parent
+    uint16_t parent;
+    uint16_t fail;        // node of the longest proper suffix that is also in the trie
+    char     letter;
+    uint8_t  depth;
+} WordNode;
+
+typedef struct {
+    WordNode nodes[WORD_TRIE_NODES];
+    uint16_t nodeCount;
+    uint16_t state;       // current node; 0 (root) when nothing typed matches
+} WordMatcher;
+
+/*******************************************************************************************
+*  GLOBAL VARIABLES
+*******************************************************************************************/
+
+extern const char *const wordList[];   // A-Z/0-9 only, no W or S (movement keys)
+extern const int         wordListCount;
+
+/*******************************************************************************************
+*  FUNCTION DECLARATIONS
+*******************************************************************************************/
+
+void     WordMatcherClear(WordMatcher *m);
+bool     WordMatcherAdd(WordMatcher *m, const char *word, int target);    // false when out of nodes
+void     WordMatcherLink(WordMatcher *m);                  // after a batch of adds, before the next feed
+void     WordMatcherRemove(WordMatcher *m, const char *word, int target);
+uint64_t WordMatcherFeed(WordMatcher *m, char key);     // targets completed by this key (state returns to the root)
+int      WordMatcherTyped(const WordMatcher *m, char *out); // current typed suffix, returns its length
+int      WordMatcherProgress(const WordMatcher *m, const char *word);  // letters of word already typed
+
+#endif // WORDS_H